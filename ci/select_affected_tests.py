@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+
+# NOTE: This script requires Python >= 3.7
+
+"""
+Selects the test categories and test cases that can be affected by a change,
+based on the include graph recorded by the compiler in an existing build.
+
+Typical usage for a pre-merge run:
+
+  ci/select_affected_tests.py <build-dir> --base origin/main \\
+      --exclude-filter unaffected.filter --ctest-regex
+
+The generated filter can be passed to SYCL_CTS_EXCLUDE_TEST_CATEGORIES, the
+ctest regex to `ctest -R`. The build directory must have been built at least
+once, so that the compiler dependency information is available.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+from generate_exclude_filter import LogLevel, find_all_categories, log
+import generate_exclude_filter
+
+# Changes to these files or directories (relative to the CTS root) can affect
+# every test category, as they are part of the build setup or of every test
+# binary without being visible in the include graph of the test sources.
+GLOBAL_INPUTS = [
+    "CMakeLists.txt",
+    "cmake/",
+    "oclmath/",
+    "util/",
+    "vendor/",
+    "tests/CMakeLists.txt",
+    "tests/common/",
+]
+
+# Changes to these files or directories never affect test results
+IGNORED_INPUTS = [
+    ".github/",
+    "ci/",
+    "docs/",
+    "tools/",
+    "README.md",
+    "CONTRIBUTING.md",
+    "LICENSE",
+    ".clang-format",
+    ".gitignore",
+]
+
+TEST_CASE_PATTERN = re.compile(
+    r'(?:TEST_CASE|TEST_CASE_SIG|TEST_CASE_METHOD|LIST_TEST_CASE)\s*'
+    r'(?:\([^()"]*\)\s*)?\(\s*(?:[\w:]+\s*,\s*)?"((?:[^"\\]|\\.)*)"')
+LEGACY_TEST_PATTERN = re.compile(r'^\s*#define\s+TEST_NAME\s+(\w+)', re.M)
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        description="""This script maps changed files to the test categories
+        and test cases that include them, using the compiler dependency
+        information of an existing CTS build.""")
+
+    parser.add_argument('build_dir', metavar="Build-Directory", type=str,
+                        help="Existing CTS build directory")
+    parser.add_argument('--base', type=str,
+                        help="Git revision to compare the CTS tree against")
+    parser.add_argument('--changed', type=str, nargs='*', default=[],
+                        help="Changed files, in addition to the ones from "
+                        "--base. Paths are relative to the CTS root, or "
+                        "absolute.")
+    parser.add_argument('--exclude-filter', type=str,
+                        help="Write unaffected categories to this file, in the "
+                        "SYCL_CTS_EXCLUDE_TEST_CATEGORIES format")
+    parser.add_argument('--ctest-regex', action='store_true',
+                        help="Print a regex for `ctest -R` selecting the "
+                        "affected categories")
+    parser.add_argument('--report', type=str,
+                        help="Write affected categories, translation units "
+                        "and test cases to this JSON file")
+    parser.add_argument('--verbose', action='store_true',
+                        help="Enable verbose logging")
+
+    return parser.parse_args()
+
+
+def get_changed_files(cts_dir: str, base: str):
+    p = subprocess.run(['git', 'diff', '--name-only', base], cwd=cts_dir,
+                       capture_output=True)
+    if p.returncode != 0:
+        log(f"Failed to list files changed since {base}:", LogLevel.ERROR)
+        log(p.stderr.decode(), LogLevel.ERROR)
+        exit(1)
+    return p.stdout.decode().splitlines()
+
+
+def parse_depfile(content: str):
+    """
+    Parses a Make-style dependency file, returning all prerequisites.
+    """
+    content = content.replace('\\\n', ' ')
+    deps = []
+    for rule in content.splitlines():
+        _, sep, prerequisites = rule.partition(': ')
+        if not sep:
+            continue
+        # Spaces within paths are escaped with a backslash
+        for dep in re.split(r'(?<!\\)\s+', prerequisites.strip()):
+            if dep:
+                deps.append(dep.replace('\\ ', ' '))
+    return deps
+
+
+def query_ninja_deps(build_dir: str):
+    """
+    Provides the dependencies of every object file as recorded by Ninja.
+    """
+    try:
+        p = subprocess.run(['ninja', '-C', build_dir, '-t', 'deps'],
+                           capture_output=True)
+    except FileNotFoundError:
+        return None
+    if p.returncode != 0:
+        return None
+
+    result = {}
+    current = None
+    for line in p.stdout.decode().splitlines():
+        if not line.strip():
+            current = None
+        elif not line.startswith(' '):
+            # "<object>: #deps <count>, deps mtime <time> (VALID)"
+            current = line.split(':', 1)[0]
+            result[current] = []
+        elif current is not None:
+            result[current].append(line.strip())
+    return result
+
+
+def find_depfile_deps(build_dir: str):
+    """
+    Provides the dependencies of every object file from the depfiles written
+    by the compiler next to the object files, as done by Makefile generators.
+    """
+    result = {}
+    for root, _, files in os.walk(build_dir):
+        for f in files:
+            if f.endswith(('.o.d', '.obj.d')):
+                path = os.path.join(root, f)
+                with open(path, errors='replace') as depfile:
+                    result[path[:-2]] = parse_depfile(depfile.read())
+    return result
+
+
+def get_category(source: str, cts_dir: str, build_dir: str):
+    """
+    Provides the test category of a test source, which can also be a source
+    generated within the build directory.
+    """
+    for root in (cts_dir, build_dir):
+        rel = os.path.relpath(source, root)
+        parts = rel.split(os.sep)
+        if len(parts) > 2 and parts[0] == 'tests' and parts[1] != 'common':
+            return parts[1]
+    return None
+
+
+def find_test_cases(source: str):
+    try:
+        with open(source, errors='replace') as f:
+            content = f.read()
+    except OSError:
+        return []
+    names = TEST_CASE_PATTERN.findall(content)
+    names += LEGACY_TEST_PATTERN.findall(content)
+    return names
+
+
+def main():
+    args = parse_arguments()
+    generate_exclude_filter.enable_verbose_logging = args.verbose
+
+    cts_dir = os.path.realpath(os.path.join(sys.path[0], ".."))
+    build_dir = os.path.realpath(args.build_dir)
+    all_categories = find_all_categories(cts_dir)
+
+    changed = list(args.changed)
+    if args.base:
+        changed += get_changed_files(cts_dir, args.base)
+    changed = {os.path.realpath(os.path.join(cts_dir, c)) for c in changed}
+    log(f"{len(changed)} changed files.")
+
+    affected = set()
+    for path in changed:
+        rel = os.path.relpath(path, cts_dir).replace(os.sep, '/')
+        if rel.startswith('../'):
+            # Outside of the CTS tree, e.g. SYCL implementation headers, which
+            # are resolved via the include graph below
+            continue
+        if any(rel == i or rel.startswith(i) for i in IGNORED_INPUTS):
+            continue
+        if any(rel == g or rel.startswith(g) for g in GLOBAL_INPUTS):
+            # Headers in tests/common are resolved via the include graph below
+            if not (rel.startswith('tests/common/') and rel.endswith('.h')):
+                log(f"{rel} affects all categories", LogLevel.VERBOSE)
+                affected.update(all_categories)
+            continue
+        parts = rel.split('/')
+        if len(parts) > 2 and parts[0] == 'tests':
+            # Any change within a category, including its CMakeLists.txt and
+            # generator inputs, affects that category
+            affected.add(parts[1])
+        elif not rel.startswith('tests/'):
+            log(f"{rel} is not known, assuming it affects all categories",
+                LogLevel.WARNING)
+            affected.update(all_categories)
+
+    deps = query_ninja_deps(build_dir)
+    if deps is None:
+        deps = find_depfile_deps(build_dir)
+    if not deps:
+        log("No compiler dependency information found, was the build "
+            "directory built?", LogLevel.ERROR)
+        exit(1)
+
+    report = {}
+    for obj, obj_deps in deps.items():
+        if not obj_deps:
+            continue
+        source = os.path.realpath(os.path.join(build_dir, obj_deps[0]))
+        category = get_category(source, cts_dir, build_dir)
+        if category is None:
+            continue
+        resolved = {os.path.realpath(os.path.join(build_dir, d))
+                    for d in obj_deps}
+        if category in affected or not resolved.isdisjoint(changed):
+            affected.add(category)
+            report.setdefault(category, {})[
+                os.path.relpath(source, cts_dir)] = find_test_cases(source)
+
+    affected = sorted(c for c in affected if c in all_categories)
+    unaffected = sorted(set(all_categories) - set(affected))
+    log(f"{len(affected)} out of {len(all_categories)} categories affected.")
+    log(', '.join(affected), LogLevel.VERBOSE)
+
+    if args.exclude_filter is not None:
+        log(f"Writing filter to file {args.exclude_filter}", LogLevel.VERBOSE)
+        with open(args.exclude_filter, "w") as output_file:
+            print("\n".join(unaffected), file=output_file)
+
+    if args.ctest_regex:
+        # Matches nothing if no category is affected
+        print(f"^test_({'|'.join(affected)})$" if affected else "^$")
+
+    if args.report is not None:
+        with open(args.report, "w") as output_file:
+            json.dump({c: report.get(c, {}) for c in affected}, output_file,
+                      indent=2)
+
+
+if __name__ == '__main__':
+    main()
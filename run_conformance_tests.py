@@ -4,8 +4,11 @@ import subprocess
 import sys
 import xml.etree.ElementTree as ET
 import json
+import statistics
 import argparse
 import shlex
+import tempfile
+import time
 
 REPORT_HEADER = """<?xml version="1.0" encoding="UTF-8"?>
 <?xml-stylesheet xmlns="http://www.w3.org/1999/xhtml" type="text/xsl" href="#stylesheet"?>
@@ -15,6 +18,21 @@ id ID #REQUIRED>
 ]>
 """
 
+# Environment variables enabling the persistent kernel cache of known
+# implementations. {cache_dir} is replaced by the temporary cache directory.
+PERSISTENT_CACHE_ENVIRONMENT = {
+    # DPC++
+    'SYCL_CACHE_PERSISTENT': '1',
+    'SYCL_CACHE_DIR': '{cache_dir}',
+    # AdaptiveCpp
+    'ACPP_APPDB_DIR': '{cache_dir}',
+}
+
+# Number of startup benchmark runs for each cache state, and the fraction of
+# the cold first kernel submission time the warm one must stay below
+STARTUP_REPETITIONS = 5
+STARTUP_WARM_MARGIN = 0.9
+
 
 def handle_args(argv):
     """
@@ -83,6 +101,20 @@ def handle_args(argv):
                         help='Test the reduced feature set instead of the full feature set.',
                         required=False,
                         action='store_true')
+    parser.add_argument(
+        '--persistent-cache-check',
+        help='Comma-separated list of test categories to run twice in fresh '
+        'processes against a temporary persistent kernel cache, checking that '
+        'the second run is faster and produces identical results.',
+        type=str,
+        required=False)
+    parser.add_argument(
+        '--persistent-cache-env',
+        help='Additional NAME=VALUE environment variable enabling the '
+        'persistent kernel cache of the implementation. {cache_dir} in VALUE '
+        'is replaced by the temporary cache directory. Can be repeated.',
+        action='append',
+        default=[])
     args = parser.parse_args(argv)
 
     full_conformance = 'OFF' if args.fast else 'ON'
@@ -93,7 +125,8 @@ def handle_args(argv):
             full_conformance, test_deprecated_features, args.exclude_categories,
             args.implementation_name, args.additional_cmake_args, args.device,
             args.additional_ctest_args, args.build_only,
-            full_feature_set)
+            full_feature_set, args.persistent_cache_check,
+            args.persistent_cache_env)
 
 
 def split_additional_args(additional_args):
@@ -270,13 +303,201 @@ def update_xml_attribs(info_json, implementation_name, test_xml_root,
     return test_xml_root
 
 
+def get_executable(name):
+    """
+    Provides the path of an executable built by the CTS, or None if it was not
+    built.
+    """
+    path = os.path.join('bin', name + ('.exe' if os.name == 'nt' else ''))
+    return path if os.path.isfile(path) else None
+
+
+def get_test_case_results(xml_file):
+    """
+    Provides the outcome and duration of each test case from a Catch2 XML
+    report.
+    """
+    results = {}
+    if not os.path.isfile(xml_file):
+        return results
+    for test_case in ET.parse(xml_file).getroot().iter('TestCase'):
+        overall = test_case.find('OverallResult')
+        if overall is None:
+            continue
+        results[test_case.attrib['name']] = {
+            'success': overall.attrib.get('success'),
+            'skips': overall.attrib.get('skips', '0'),
+            'duration': float(overall.attrib.get('durationInSeconds', 0)),
+        }
+    return results
+
+
+def run_category_in_fresh_process(executable, device, env, xml_file):
+    """
+    Runs a test executable in a new process.
+    Returns the return code, the wall time and the test case results.
+    """
+    call = [executable, '--device', device, '--durations', 'yes',
+            '--reporter', 'xml', '--out', xml_file]
+    print("subprocess.call:\n  %s" % " ".join(call))
+    start = time.perf_counter()
+    return_code = subprocess.call(call, env=env)
+    wall_time = time.perf_counter() - start
+    return return_code, wall_time, get_test_case_results(xml_file)
+
+
+def run_startup_benchmark(device, env, output_file, repetitions=1):
+    """
+    Runs the startup benchmark on the device given, each repetition in a new
+    process, if it was built with SYCL_CTS_ENABLE_BENCHMARKS.
+    Returns the median phase timings in microseconds, or None.
+    """
+    executable = get_executable('startup_benchmark')
+    if executable is None:
+        return None
+    call = [executable, '--device', device, '--repetitions', str(repetitions),
+            '--output', output_file]
+    print("subprocess.call:\n  %s" % " ".join(call))
+    if subprocess.call(call, env=env) != 0:
+        return None
+    with open(output_file, 'r') as summary:
+        phases = json.load(summary)['phases-us']
+    return {name: values['median'] for name, values in phases.items()}
+
+
+def count_files(directory):
+    """
+    Counts the files within a directory and its subdirectories.
+    """
+    return sum(len(files) for _, _, files in os.walk(directory))
+
+
+def run_persistent_cache_check(categories, device, extra_env):
+    """
+    Runs the test categories given twice, each time in a fresh process, with
+    the persistent kernel cache of the implementation directed to an empty
+    temporary directory.
+    Checks that the cache is populated by the first run, that the second run
+    is faster, and that both runs produce identical results.
+    Writes the timings to persistent_cache_report.json.
+    Returns a non-zero error code if any check fails.
+    """
+    error_code = 0
+    report = {'categories': {}}
+
+    def fail(message):
+        nonlocal error_code
+        print('Error: ' + message)
+        error_code = 1
+
+    variables = dict(PERSISTENT_CACHE_ENVIRONMENT)
+    for assignment in extra_env:
+        name, _, value = assignment.partition('=')
+        variables[name] = value
+
+    def cache_environment(cache_dir):
+        env = dict(os.environ)
+        for name, value in variables.items():
+            env[name] = value.replace('{cache_dir}', cache_dir)
+        return env
+
+    # Every cold startup run needs an empty cache of its own, as the first
+    # run populates it
+    cold_runs = []
+    for repetition in range(STARTUP_REPETITIONS):
+        with tempfile.TemporaryDirectory(prefix='sycl_cts_cache_') as empty:
+            startup = run_startup_benchmark(
+                device, cache_environment(empty),
+                'persistent_cache_startup_cold_%d.json' % repetition)
+        if startup is None:
+            break
+        cold_runs.append(startup)
+    cold_startup = None
+    if len(cold_runs) == STARTUP_REPETITIONS:
+        cold_startup = {name: statistics.median(run[name] for run in cold_runs)
+                        for name in cold_runs[0]}
+
+    with tempfile.TemporaryDirectory(prefix='sycl_cts_cache_') as cache_dir:
+        env = cache_environment(cache_dir)
+        if cold_startup is not None:
+            # Populates the cache with the startup kernel for the warm runs
+            run_startup_benchmark(device, env,
+                                  'persistent_cache_startup_populate.json')
+
+        total = {'cold': 0.0, 'warm': 0.0}
+        for category in categories:
+            executable = get_executable('test_' + category)
+            if executable is None:
+                fail('test category %s was not built' % category)
+                continue
+
+            runs = {}
+            for run in ('cold', 'warm'):
+                cached_files = count_files(cache_dir)
+                xml_file = 'persistent_cache_%s_%s.xml' % (category, run)
+                runs[run] = run_category_in_fresh_process(
+                    executable, device, env, xml_file)
+                total[run] += runs[run][1]
+                if run == 'cold' and count_files(cache_dir) == cached_files:
+                    fail('nothing was written to the persistent cache by '
+                         'test_%s, check the cache environment variables'
+                         % category)
+
+            (cold_code, cold_time, cold_results) = runs['cold']
+            (warm_code, warm_time, warm_results) = runs['warm']
+            if cold_code != warm_code or cold_results.keys() != \
+                    warm_results.keys():
+                fail('test_%s ran different test cases or returned different '
+                     'codes with a warm cache' % category)
+            for name in cold_results.keys() & warm_results.keys():
+                cold_case = cold_results[name]
+                warm_case = warm_results[name]
+                if (cold_case['success'], cold_case['skips']) != \
+                        (warm_case['success'], warm_case['skips']):
+                    fail('"%s" of test_%s has a different result with a warm '
+                         'cache' % (name, category))
+
+            report['categories'][category] = {
+                'cold-seconds': cold_time,
+                'warm-seconds': warm_time,
+                'test-cases': {
+                    name: {'cold-seconds': cold_results[name]['duration'],
+                           'warm-seconds': warm_results[name]['duration']}
+                    for name in cold_results.keys() & warm_results.keys()
+                },
+            }
+            print('test_%s: %.2f s with a cold cache, %.2f s with a warm cache'
+                  % (category, cold_time, warm_time))
+
+        if total['warm'] >= total['cold'] > 0:
+            fail('the warm cache runs were not faster than the cold ones')
+
+        warm_startup = run_startup_benchmark(
+            device, env, 'persistent_cache_startup_warm.json',
+            STARTUP_REPETITIONS)
+        if cold_startup is not None and warm_startup is not None:
+            report['startup-cold-us'] = cold_startup
+            report['startup-warm-us'] = warm_startup
+            # Medians of several runs, with a margin against noise
+            if warm_startup['first_kernel'] > \
+                    STARTUP_WARM_MARGIN * cold_startup['first_kernel']:
+                fail('the median first kernel submission was not at least '
+                     '%d%% faster with a warm cache'
+                     % round(100 * (1 - STARTUP_WARM_MARGIN)))
+
+    with open('persistent_cache_report.json', 'w') as report_file:
+        json.dump(report, report_file, indent=2)
+    return error_code
+
+
 def main(argv=sys.argv[1:]):
 
     # Parse and gather all the script args
     (cmake_exe, build_system_name, build_system_call, full_conformance,
      test_deprecated_features, exclude_categories, implementation_name,
      additional_cmake_args, device, additional_ctest_args,
-     build_only, full_feature_set) = handle_args(argv)
+     build_only, full_feature_set, persistent_cache_check,
+     persistent_cache_env) = handle_args(argv)
 
     # Generate a cmake call in a form accepted by subprocess.call()
     cmake_call = generate_cmake_call(cmake_exe, build_system_name,
@@ -325,6 +546,15 @@ def main(argv=sys.argv[1:]):
     with open("conformance_report.xml", 'w') as final_conformance_report:
         final_conformance_report.write(report)
 
+    # Optionally validate the persistent kernel cache with additional runs,
+    # which do not affect the conformance report
+    if persistent_cache_check:
+        categories = [c.strip() for c in persistent_cache_check.split(',')
+                      if c.strip()]
+        cache_error_code = run_persistent_cache_check(categories, device,
+                                                      persistent_cache_env)
+        error_code = error_code or cache_error_code
+
     return error_code
 
 
@@ -0,0 +1,233 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the same read-modify-write loop over global, local
+//  and private memory accessed through:
+//   - a raw pointer
+//   - global_ptr, local_ptr or private_ptr, decorated and undecorated
+//   - a generic address space multi_ptr, decorated and undecorated
+//  Generic access that is noticeably slower than explicit access to the same
+//  memory is reported, as it indicates missing address space inference or
+//  runtime address space checks.
+//
+*******************************************************************************/
+
+#include "../common/assertions.h"
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace benchmark_address_space_pointer_throughput {
+using namespace sycl_cts;
+
+using sycl::access::address_space;
+using sycl::access::decorated;
+
+constexpr size_t work_items = 1 << 20;
+constexpr size_t group_size = 64;
+// Number of elements each work-item accesses repeatedly
+constexpr size_t window = 16;
+constexpr int iterations = 256;
+constexpr int repetitions = 5;
+// Generic access slower than explicit access by more than this factor is
+// reported
+constexpr double tolerated_slowdown = 1.1;
+
+enum class pointer_kind {
+  raw,
+  explicit_decorated,
+  explicit_undecorated,
+  generic_decorated,
+  generic_undecorated
+};
+
+inline const char* to_string(pointer_kind kind) {
+  switch (kind) {
+    case pointer_kind::raw:
+      return "raw pointer";
+    case pointer_kind::explicit_decorated:
+      return "explicit multi_ptr, decorated";
+    case pointer_kind::explicit_undecorated:
+      return "explicit multi_ptr, undecorated";
+    case pointer_kind::generic_decorated:
+      return "generic multi_ptr, decorated";
+    default:
+      return "generic multi_ptr, undecorated";
+  }
+}
+
+inline const char* to_string(address_space space) {
+  switch (space) {
+    case address_space::global_space:
+      return "global";
+    case address_space::local_space:
+      return "local";
+    default:
+      return "private";
+  }
+}
+
+template <address_space Space, pointer_kind Kind>
+class access_kernel;
+
+/** @brief Provides the pointer of the kind given to memory in Space
+ *  @details Explicit multi_ptr types are global_ptr, local_ptr and private_ptr
+ *           with the decoration given
+ */
+template <address_space Space, pointer_kind Kind>
+auto make_pointer(unsigned* raw) {
+  if constexpr (Kind == pointer_kind::raw) {
+    return raw;
+  } else if constexpr (Kind == pointer_kind::explicit_decorated) {
+    return sycl::address_space_cast<Space, decorated::yes>(raw);
+  } else if constexpr (Kind == pointer_kind::explicit_undecorated) {
+    return sycl::address_space_cast<Space, decorated::no>(raw);
+  } else if constexpr (Kind == pointer_kind::generic_decorated) {
+    return sycl::address_space_cast<address_space::generic_space,
+                                    decorated::yes>(raw);
+  } else {
+    return sycl::address_space_cast<address_space::generic_space,
+                                    decorated::no>(raw);
+  }
+}
+
+/** @brief Loop shared by all kernels and the host reference
+ */
+template <typename PtrT>
+unsigned run_loop(PtrT ptr, size_t offset, unsigned seed) {
+  for (size_t k = 0; k < window; ++k) {
+    ptr[offset + k] = seed + static_cast<unsigned>(k);
+  }
+  unsigned sum = 0;
+  for (int i = 0; i < iterations; ++i) {
+    const size_t index = offset + (i * 7) % window;
+    ptr[index] = ptr[index] * 3u + sum;
+    sum += ptr[index];
+  }
+  return sum;
+}
+
+struct buffers {
+  sycl::buffer<unsigned, 1> scratch{sycl::range<1>{work_items * window}};
+  sycl::buffer<unsigned, 1> results{sycl::range<1>{work_items}};
+};
+
+template <address_space Space, pointer_kind Kind>
+void submit(sycl::queue& queue, buffers& data) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor scratch{data.scratch, cgh, sycl::read_write,
+                               sycl::no_init};
+        sycl::accessor results{data.results, cgh, sycl::write_only,
+                               sycl::no_init};
+        sycl::local_accessor<unsigned, 1> local{
+            sycl::range<1>{group_size * window}, cgh};
+        cgh.parallel_for<access_kernel<Space, Kind>>(
+            sycl::nd_range<1>{work_items, group_size},
+            [=](sycl::nd_item<1> item) {
+              const size_t id = item.get_global_id(0);
+              const unsigned seed = static_cast<unsigned>(id);
+              if constexpr (Space == address_space::global_space) {
+                unsigned* raw =
+                    scratch.template get_multi_ptr<decorated::no>().get_raw();
+                results[id] = run_loop(make_pointer<Space, Kind>(raw),
+                                       id * window, seed);
+              } else if constexpr (Space == address_space::local_space) {
+                unsigned* raw =
+                    local.template get_multi_ptr<decorated::no>().get_raw();
+                results[id] = run_loop(make_pointer<Space, Kind>(raw),
+                                       item.get_local_id(0) * window, seed);
+              } else {
+                unsigned values[window];
+                results[id] =
+                    run_loop(make_pointer<Space, Kind>(values), 0, seed);
+              }
+            });
+      })
+      .wait_and_throw();
+}
+
+/** @brief Provides the fastest of several runs of the kernel, in nanoseconds
+ */
+template <address_space Space, pointer_kind Kind>
+double measure(sycl::queue& queue, buffers& data,
+               const std::vector<unsigned>& expected) {
+  submit<Space, Kind>(queue, data);
+  {
+    sycl::host_accessor results{data.results, sycl::read_only};
+    INFO(to_string(Space) << " memory through " << to_string(Kind));
+    CHECK_ALL_EQUAL(work_items, results.get_pointer(), expected.data());
+  }
+
+  const double best_ns = benchmark_common::best_of_ns(
+      repetitions, [&] { submit<Space, Kind>(queue, data); });
+  const double accesses = 2.0 * work_items * (iterations + window);
+  benchmark_common::report(std::string(to_string(Space)) + " memory through " +
+                               to_string(Kind) + ", throughput",
+                           accesses / best_ns, "G accesses/s");
+  return best_ns;
+}
+
+template <address_space Space>
+void run_benchmarks(sycl::queue& queue, buffers& data,
+                    const std::vector<unsigned>& expected) {
+  measure<Space, pointer_kind::raw>(queue, data, expected);
+  const double explicit_ns =
+      std::min(measure<Space, pointer_kind::explicit_decorated>(queue, data,
+                                                                expected),
+               measure<Space, pointer_kind::explicit_undecorated>(queue, data,
+                                                                  expected));
+  const double generic_ns =
+      std::min(measure<Space, pointer_kind::generic_decorated>(queue, data,
+                                                               expected),
+               measure<Space, pointer_kind::generic_undecorated>(queue, data,
+                                                                 expected));
+
+  benchmark_common::report_ratio(
+      std::string("generic vs. explicit access to ") + to_string(Space) +
+          " memory",
+      generic_ns, explicit_ns, tolerated_slowdown,
+      std::string("Generic access to ") + to_string(Space) +
+          " memory is slower than explicit access");
+}
+
+TEST_CASE("Generic vs. explicit address space pointer throughput",
+          "[benchmark][address_space][multi_ptr]") {
+  auto queue = once_per_unit::get_queue();
+  buffers data;
+
+  std::vector<unsigned> expected(work_items);
+  std::vector<unsigned> values(window);
+  for (size_t i = 0; i < work_items; ++i) {
+    expected[i] = run_loop(values.data(), 0, static_cast<unsigned>(i));
+  }
+
+  SECTION("global") {
+    run_benchmarks<address_space::global_space>(queue, data, expected);
+  }
+  SECTION("local") {
+    run_benchmarks<address_space::local_space>(queue, data, expected);
+  }
+  SECTION("private") {
+    run_benchmarks<address_space::private_space>(queue, data, expected);
+  }
+}
+
+}  // namespace benchmark_address_space_pointer_throughput
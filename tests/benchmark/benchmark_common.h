@@ -0,0 +1,106 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides common functionality for the performance benchmarks.
+//  Timings are collected through Catch2's BENCHMARK macros; derived values
+//  that are not plain durations are reported with report().
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_BENCHMARK_BENCHMARK_COMMON_H
+#define __SYCLCTS_TESTS_BENCHMARK_BENCHMARK_COMMON_H
+
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+
+namespace benchmark_common {
+
+using clock = std::chrono::steady_clock;
+
+/** @brief Reports a measured value that is not covered by BENCHMARK output,
+ *         e.g. a throughput or a ratio between two measurements
+ */
+inline void report(const std::string& name, double value,
+                   const std::string& unit) {
+  WARN(name << ": " << value << " " << unit);
+}
+
+/** @brief Measures the wall-clock duration of a single call of the callable
+ *         given, in nanoseconds
+ */
+template <typename ActionT>
+double measure_ns(ActionT&& action) {
+  const auto start = clock::now();
+  action();
+  const auto end = clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/** @brief Callable doing nothing, the default for the optional steps of
+ *         best_of_ns
+ */
+struct no_op {
+  void operator()() const {}
+};
+
+/** @brief Provides the fastest of several calls of the action given, in
+ *         nanoseconds
+ *  @param setup Called before each call of the action, not measured
+ *  @param check Called after each call of the action, not measured, e.g. to
+ *         verify the results of every repetition
+ */
+template <typename ActionT, typename SetupT = no_op, typename CheckT = no_op>
+double best_of_ns(int repetitions, ActionT&& action, SetupT&& setup = {},
+                  CheckT&& check = {}) {
+  double best_ns = std::numeric_limits<double>::max();
+  for (int r = 0; r < repetitions; ++r) {
+    setup();
+    best_ns = std::min(best_ns, measure_ns(action));
+    check();
+  }
+  return best_ns;
+}
+
+/** @brief Reports the time of a measurement relative to its baseline, and
+ *         warns if it exceeds the tolerated factor
+ *  @param slower Description of the measurement being slower than the
+ *         baseline, completed with the factor in the warning
+ *  @retval Time ratio of the measurement to the baseline
+ */
+inline double report_ratio(const std::string& name, double ns,
+                           double baseline_ns, double tolerance,
+                           const std::string& slower) {
+  const double ratio = ns / baseline_ns;
+  report(name, ratio, "x time");
+  if (ratio > tolerance) {
+    WARN(slower << " by " << ratio << "x");
+  }
+  return ratio;
+}
+
+}  // namespace benchmark_common
+
+#endif  // __SYCLCTS_TESTS_BENCHMARK_BENCHMARK_COMMON_H
@@ -0,0 +1,240 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the runtime error paths:
+//   - throw-to-catch latency of synchronous sycl::exception for common errc
+//     values, from a single thread and from several threads at once
+//   - delivery throughput of asynchronous exceptions when thousands of
+//     failing command groups feed large exception_lists into an async
+//     handler, from a single queue and from several queues at once
+//  Error paths that do not scale with the number of host threads are
+//  reported as serialized, and host memory growing with the number of
+//  asynchronous exceptions delivered is reported as a leak.
+//
+*******************************************************************************/
+
+#include "../../util/memory_tracker.h"
+#include "benchmark_common.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark_exception_paths {
+using namespace sycl_cts;
+
+constexpr int latency_iterations = 2000;
+constexpr int storm_size = 4096;
+constexpr int leak_check_storms = 5;
+constexpr unsigned thread_count = 4;
+// Host memory growth per delivered exception beyond this is reported
+constexpr double tolerated_bytes_per_exception = 256.0;
+
+class nd_range_error_kernel;
+
+struct error_trigger {
+  std::string name;
+  sycl::errc expected;
+  std::function<void(sycl::queue&)> trigger;
+};
+
+std::vector<error_trigger> get_triggers() {
+  sycl::buffer<int, 1> buffer{sycl::range<1>{4}};
+  return {
+      // Baseline: cost of the C++ exception machinery alone
+      {"throw of sycl::exception", sycl::errc::runtime,
+       [](sycl::queue&) { throw sycl::exception(sycl::errc::runtime); }},
+      {"nd_range with non-uniform work-groups", sycl::errc::nd_range,
+       [](sycl::queue& queue) {
+         queue.submit([&](sycl::handler& cgh) {
+           cgh.parallel_for<nd_range_error_kernel>(
+               sycl::nd_range<1>{sycl::range<1>{10}, sycl::range<1>{3}},
+               [=](sycl::nd_item<1>) {});
+         });
+       }},
+      {"host_accessor range exceeding the buffer", sycl::errc::invalid,
+       [buffer](sycl::queue&) mutable {
+         sycl::host_accessor acc{buffer, sycl::range<1>{8}};
+       }},
+      {"sub-buffer exceeding the parent buffer", sycl::errc::invalid,
+       [buffer](sycl::queue&) mutable {
+         sycl::buffer<int, 1> sub{buffer, sycl::id<1>{2}, sycl::range<1>{4}};
+       }},
+  };
+}
+
+/** @brief Triggers the error repeatedly
+ *  @retval Number of exceptions caught with the expected error code
+ */
+int trigger_repeatedly(const error_trigger& error, sycl::queue& queue) {
+  int caught = 0;
+  for (int i = 0; i < latency_iterations; ++i) {
+    try {
+      error.trigger(queue);
+    } catch (const sycl::exception& e) {
+      caught += e.code() == error.expected;
+    }
+  }
+  return caught;
+}
+
+void run_sync_latency(const sycl::device& device) {
+  for (const auto& error : get_triggers()) {
+    sycl::queue queue{device};
+    // Some implementations might report the error asynchronously instead,
+    // which is covered by the storm benchmark
+    if (trigger_repeatedly(error, queue) != latency_iterations) {
+      WARN(error.name << " does not throw sycl::exception with the expected "
+                         "error code synchronously");
+      queue.wait();
+      continue;
+    }
+
+    const double single_ns = benchmark_common::measure_ns(
+        [&] { trigger_repeatedly(error, queue); });
+    benchmark_common::report(error.name + ", throw-to-catch latency",
+                             single_ns / latency_iterations / 1e3, "us");
+
+    std::atomic<int> caught{0};
+    const double parallel_ns = benchmark_common::measure_ns([&] {
+      std::vector<std::thread> threads;
+      for (unsigned t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+          sycl::queue thread_queue{device};
+          caught += trigger_repeatedly(error, thread_queue);
+        });
+      }
+      for (auto& thread : threads) thread.join();
+    });
+    CHECK(caught == static_cast<int>(thread_count) * latency_iterations);
+
+    // Ideal scaling is thread_count, 1 or less means the error path is
+    // serialized across threads
+    const double scaling = single_ns * thread_count / parallel_ns;
+    benchmark_common::report(error.name + ", throughput scaling with " +
+                                 std::to_string(thread_count) + " threads",
+                             scaling, "x");
+    if (scaling <= 1.0) {
+      WARN(error.name << ": error path is serialized across host threads");
+    }
+  }
+}
+
+struct storm_statistics {
+  std::atomic<size_t> delivered{0};
+  std::atomic<size_t> handler_calls{0};
+  std::atomic<size_t> largest_list{0};
+};
+
+/** @brief Submits storm_size failing command groups and waits for their
+ *         exceptions to be delivered to the async handler
+ */
+void run_storm(const sycl::device& device, storm_statistics& stats) {
+  auto handler = [&stats](sycl::exception_list list) {
+    ++stats.handler_calls;
+    size_t largest = stats.largest_list.load();
+    while (largest < list.size() &&
+           !stats.largest_list.compare_exchange_weak(largest, list.size())) {
+    }
+    for (auto& e_ptr : list) {
+      try {
+        std::rethrow_exception(e_ptr);
+      } catch (const sycl::exception&) {
+        ++stats.delivered;
+      }
+    }
+  };
+  sycl::queue queue{device, handler};
+  for (int i = 0; i < storm_size; ++i) {
+    queue.submit([&](sycl::handler& cgh) {
+      cgh.host_task([=] { throw sycl::exception(sycl::errc::runtime); });
+    });
+  }
+  queue.wait_and_throw();
+}
+
+void run_async_storm(const sycl::device& device) {
+  {
+    storm_statistics stats;
+    const double ns =
+        benchmark_common::measure_ns([&] { run_storm(device, stats); });
+    CHECK(stats.delivered == static_cast<size_t>(storm_size));
+    benchmark_common::report(std::to_string(storm_size) +
+                                 " failing command groups, delivery "
+                                 "throughput",
+                             stats.delivered / (ns / 1e9), "exceptions/s");
+    benchmark_common::report("async handler invocations",
+                             static_cast<double>(stats.handler_calls),
+                             "calls");
+    benchmark_common::report("largest exception_list",
+                             static_cast<double>(stats.largest_list),
+                             "exceptions");
+
+    storm_statistics parallel_stats;
+    const double parallel_ns = benchmark_common::measure_ns([&] {
+      std::vector<std::thread> threads;
+      for (unsigned t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] { run_storm(device, parallel_stats); });
+      }
+      for (auto& thread : threads) thread.join();
+    });
+    CHECK(parallel_stats.delivered ==
+          static_cast<size_t>(storm_size) * thread_count);
+    const double scaling = ns * thread_count / parallel_ns;
+    benchmark_common::report("exception storms on " +
+                                 std::to_string(thread_count) +
+                                 " queues at once, throughput scaling",
+                             scaling, "x");
+    if (scaling <= 1.0) {
+      WARN("Asynchronous exception delivery is serialized across queues");
+    }
+  }
+
+  // The storms above serve as warm-up, so that one-time allocations of the
+  // runtime are not accounted as a leak
+  const auto before = util::get_host_memory_usage();
+  if (before.current_rss == 0) return;
+  for (int s = 0; s < leak_check_storms; ++s) {
+    storm_statistics stats;
+    run_storm(device, stats);
+  }
+  const auto after = util::get_host_memory_usage();
+  const double bytes_per_exception =
+      (static_cast<double>(after.current_rss) - before.current_rss) /
+      (leak_check_storms * storm_size);
+  benchmark_common::report("host memory growth per delivered exception",
+                           bytes_per_exception, "bytes");
+  if (bytes_per_exception > tolerated_bytes_per_exception) {
+    WARN("Host memory grows by " << bytes_per_exception
+                                 << " bytes per delivered asynchronous "
+                                    "exception, the runtime might leak");
+  }
+}
+
+TEST_CASE("Exception path latency and async exception delivery",
+          "[benchmark][exception]") {
+  const auto device = once_per_unit::get_queue().get_device();
+
+  SECTION("synchronous exceptions") { run_sync_latency(device); }
+  SECTION("asynchronous exception storm") { run_async_storm(device); }
+}
+
+}  // namespace benchmark_exception_paths
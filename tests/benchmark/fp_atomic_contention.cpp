@@ -0,0 +1,33 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides atomic_ref fetch_add contention benchmarks for float
+//
+*******************************************************************************/
+
+#include "fp_atomic_contention.h"
+
+namespace benchmark_fp_atomic_contention {
+
+TEST_CASE("Floating point atomic fetch_add under contention, float",
+          "[benchmark][atomic_ref]") {
+  auto queue = once_per_unit::get_queue();
+  fp_atomic_contention::run_contention<float, int>(queue, "float", "int");
+}
+
+}  // namespace benchmark_fp_atomic_contention
@@ -0,0 +1,173 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for atomic_ref fetch_add on floating point types under
+//  contention, from a single target shared by all work-items to a histogram
+//  of many targets, for an increasing number of work-items. Each case is
+//  compared against:
+//   - integer atomic_ref fetch_add of the same size, as a baseline
+//   - a manual compare_exchange_weak loop on the floating point atomic_ref,
+//     as done by backends emulating floating point atomics
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_BENCHMARK_FP_ATOMIC_CONTENTION_H
+#define __SYCLCTS_TESTS_BENCHMARK_FP_ATOMIC_CONTENTION_H
+
+#include "../common/assertions.h"
+#include "benchmark_common.h"
+
+#include <string>
+#include <vector>
+
+namespace fp_atomic_contention {
+using namespace sycl_cts;
+
+constexpr int ops_per_item = 16;
+constexpr int repetitions = 3;
+// Number of atomic targets, from full to low contention
+constexpr size_t target_counts[] = {1, 32, 1024};
+// Work-item counts; the largest count keeps every counter below 2^24, so
+// that float results are exact
+constexpr size_t work_item_counts[] = {1024, 16384, 262144};
+
+enum class method { fetch_add, cas_loop };
+
+inline const char* to_string(method m) {
+  return m == method::fetch_add ? "fetch_add" : "compare_exchange loop";
+}
+
+template <typename T, method Method>
+class contention_kernel;
+
+/** @brief Provides the target of the operation given; used on host and
+ *         device
+ */
+inline size_t target_of(size_t id, int op, size_t targets) {
+  return (id * 2654435761u + static_cast<size_t>(op) * 40503u) % targets;
+}
+
+template <typename T, method Method>
+void submit(sycl::queue& queue, sycl::buffer<T, 1>& counters, size_t items,
+            size_t targets) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{counters, cgh, sycl::read_write};
+        cgh.parallel_for<contention_kernel<T, Method>>(
+            sycl::range<1>{items}, [=](sycl::id<1> id) {
+              for (int op = 0; op < ops_per_item; ++op) {
+                sycl::atomic_ref<T, sycl::memory_order::relaxed,
+                                 sycl::memory_scope::device,
+                                 sycl::access::address_space::global_space>
+                    ref{acc[target_of(id[0], op, targets)]};
+                if constexpr (Method == method::fetch_add) {
+                  ref.fetch_add(T{1});
+                } else {
+                  T expected = ref.load();
+                  while (!ref.compare_exchange_weak(expected,
+                                                    expected + T{1})) {
+                  }
+                }
+              }
+            });
+      })
+      .wait_and_throw();
+}
+
+/** @brief Provides the fastest of several runs of the kernel, in nanoseconds
+ */
+template <typename T, method Method>
+double measure(sycl::queue& queue, size_t items, size_t targets,
+               const std::string& name) {
+  sycl::buffer<T, 1> counters{sycl::range<1>{targets}};
+  std::vector<T> expected(targets, T{0});
+  for (size_t id = 0; id < items; ++id) {
+    for (int op = 0; op < ops_per_item; ++op) {
+      expected[target_of(id, op, targets)] += T{1};
+    }
+  }
+
+  const double best_ns = benchmark_common::best_of_ns(
+      repetitions,
+      [&] { submit<T, Method>(queue, counters, items, targets); },
+      [&] {
+        queue
+            .submit([&](sycl::handler& cgh) {
+              sycl::accessor acc{counters, cgh, sycl::write_only,
+                                 sycl::no_init};
+              cgh.fill(acc, T{0});
+            })
+            .wait_and_throw();
+      },
+      [&] {
+        sycl::host_accessor acc{counters, sycl::read_only};
+        INFO(name << ", " << to_string(Method));
+        CHECK_ALL_EQUAL(targets, acc.get_pointer(), expected.data());
+      });
+
+  benchmark_common::report(name + ", " + to_string(Method),
+                           items * ops_per_item / best_ns, "G atomic ops/s");
+  return best_ns;
+}
+
+/** @brief Runs all contention levels and work-item counts for the floating
+ *         point type and the integer baseline of the same size
+ */
+template <typename FpT, typename IntT>
+void run_contention(sycl::queue& queue, const std::string& fp_name,
+                    const std::string& int_name) {
+  for (const size_t targets : target_counts) {
+    double first_fp_ns = 0.0;
+    for (const size_t items : work_item_counts) {
+      const std::string suffix = ", " + std::to_string(targets) +
+                                 " targets, " + std::to_string(items) +
+                                 " work-items";
+      const double int_ns = measure<IntT, method::fetch_add>(
+          queue, items, targets, int_name + suffix);
+      const double fp_ns = measure<FpT, method::fetch_add>(
+          queue, items, targets, fp_name + suffix);
+      const double cas_ns = measure<FpT, method::cas_loop>(
+          queue, items, targets, fp_name + suffix);
+
+      benchmark_common::report(fp_name + " vs. " + int_name + " fetch_add" +
+                                   suffix,
+                               fp_ns / int_ns, "x time");
+      benchmark_common::report(
+          fp_name + " fetch_add vs. compare_exchange loop" + suffix,
+          fp_ns / cas_ns, "x time");
+
+      if (first_fp_ns == 0.0) {
+        first_fp_ns = fp_ns;
+      } else {
+        // Ideal scaling keeps the time per operation constant, i.e. the
+        // throughput grows with the number of work-items until the device
+        // is saturated
+        const double scale = static_cast<double>(items) / work_item_counts[0];
+        benchmark_common::report(fp_name + " fetch_add throughput scaling" +
+                                     suffix,
+                                 scale * first_fp_ns / fp_ns,
+                                 "x of " + std::to_string(work_item_counts[0]) +
+                                     " work-items");
+      }
+    }
+  }
+}
+
+}  // namespace fp_atomic_contention
+
+#endif  // __SYCLCTS_TESTS_BENCHMARK_FP_ATOMIC_CONTENTION_H
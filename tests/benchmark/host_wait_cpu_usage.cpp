@@ -0,0 +1,259 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides measurements of the host CPU consumed while waiting for a long
+//  running kernel with queue::wait, queue::wait_and_throw, event::wait,
+//  event::wait_and_throw and host_accessor construction. CPU time of the
+//  waiting thread close to the wall time means the runtime busy-spins, CPU
+//  time close to zero means it blocks.
+//  Additionally, the wake-up latency after the kernel completion is measured.
+//
+*******************************************************************************/
+
+#include "benchmark_common.h"
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark_host_wait_cpu_usage {
+using namespace sycl_cts;
+
+#if defined(__linux__)
+
+constexpr double target_kernel_ms = 250.0;
+constexpr size_t work_items = 64;
+// Upper bound of the kernel loop iterations, well within the range of the
+// unsigned loop counter
+constexpr uint64_t max_iterations = uint64_t{1} << 30;
+
+class long_kernel;
+
+using buffer_t = sycl::buffer<float, 1>;
+
+/** @brief CPU time consumed so far, in nanoseconds
+ *  @param who RUSAGE_THREAD for the calling thread, RUSAGE_SELF for the
+ *         whole process
+ */
+double cpu_time_ns(int who) {
+  rusage usage{};
+  getrusage(who, &usage);
+  auto to_ns = [](const timeval& t) {
+    return t.tv_sec * 1e9 + t.tv_usec * 1e3;
+  };
+  return to_ns(usage.ru_utime) + to_ns(usage.ru_stime);
+}
+
+sycl::event submit_long_kernel(sycl::queue& queue, buffer_t& buffer,
+                               unsigned iterations) {
+  return queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor acc{buffer, cgh, sycl::read_write};
+    const sycl::range<1> range{work_items};
+    cgh.parallel_for<long_kernel>(range, [=](sycl::id<1> id) {
+      float value = acc[id];
+      for (unsigned i = 0; i < iterations; ++i) {
+        value = value * 0.999999f + 1e-6f;
+      }
+      acc[id] = value;
+    });
+  });
+}
+
+/** @brief Provides the number of loop iterations for the kernel to run for
+ *         about target_kernel_ms
+ */
+unsigned calibrate(sycl::queue& queue, buffer_t& buffer) {
+  uint64_t iterations = uint64_t{1} << 16;
+  submit_long_kernel(queue, buffer, static_cast<unsigned>(iterations))
+      .wait_and_throw();
+  while (iterations < max_iterations) {
+    const double ms =
+        benchmark_common::measure_ns([&] {
+          submit_long_kernel(queue, buffer, static_cast<unsigned>(iterations))
+              .wait_and_throw();
+        }) /
+        1e6;
+    if (ms >= target_kernel_ms / 4) {
+      return static_cast<unsigned>(
+          std::min(iterations * (target_kernel_ms / ms),
+                   static_cast<double>(max_iterations)));
+    }
+    iterations *= 4;
+  }
+  return static_cast<unsigned>(max_iterations);
+}
+
+struct wait_strategy {
+  std::string name;
+  std::function<void(sycl::queue&, sycl::event&, buffer_t&)> wait;
+  /** @brief Whether the strategy returns as soon as the kernel completes
+   */
+  bool wakes_up_on_completion;
+};
+
+std::vector<wait_strategy> get_strategies() {
+  return {
+      {"queue::wait",
+       [](sycl::queue& q, sycl::event&, buffer_t&) { q.wait(); }, true},
+      {"queue::wait_and_throw",
+       [](sycl::queue& q, sycl::event&, buffer_t&) { q.wait_and_throw(); },
+       true},
+      {"event::wait",
+       [](sycl::queue&, sycl::event& e, buffer_t&) { e.wait(); }, true},
+      {"event::wait_and_throw",
+       [](sycl::queue&, sycl::event& e, buffer_t&) { e.wait_and_throw(); },
+       true},
+      {"host_accessor construction",
+       [](sycl::queue&, sycl::event&, buffer_t& b) {
+         sycl::host_accessor acc{b, sycl::read_only};
+       },
+       true},
+      // Baseline: CPU time consumed by the runtime itself while the host
+      // does not wait at all
+      {"sleep, then event::wait",
+       [](sycl::queue&, sycl::event& e, buffer_t&) {
+         std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(
+             target_kernel_ms * 1.5));
+         e.wait();
+       },
+       false},
+  };
+}
+
+void run_cpu_usage(sycl::queue& queue, buffer_t& buffer,
+                   unsigned iterations) {
+  for (const auto& strategy : get_strategies()) {
+    sycl::event event = submit_long_kernel(queue, buffer, iterations);
+    const double thread_start = cpu_time_ns(RUSAGE_THREAD);
+    const double process_start = cpu_time_ns(RUSAGE_SELF);
+    const double wall_ns = benchmark_common::measure_ns(
+        [&] { strategy.wait(queue, event, buffer); });
+    const double thread_ns = cpu_time_ns(RUSAGE_THREAD) - thread_start;
+    const double process_ns = cpu_time_ns(RUSAGE_SELF) - process_start;
+
+    benchmark_common::report(strategy.name + ", wall time", wall_ns / 1e6,
+                             "ms");
+    benchmark_common::report(strategy.name + ", waiting thread CPU time",
+                             thread_ns / wall_ns * 100.0, "% of wall time");
+    benchmark_common::report(strategy.name + ", process CPU time",
+                             process_ns / wall_ns * 100.0, "% of wall time");
+  }
+}
+
+/** @brief Several host threads waiting for the same event at once
+ */
+void run_multiple_waiters(sycl::queue& queue, buffer_t& buffer,
+                          unsigned iterations) {
+  const unsigned waiter_count = 4;
+  sycl::event event = submit_long_kernel(queue, buffer, iterations);
+  const double process_start = cpu_time_ns(RUSAGE_SELF);
+  const double wall_ns = benchmark_common::measure_ns([&] {
+    std::vector<std::thread> waiters;
+    for (unsigned i = 0; i < waiter_count; ++i) {
+      waiters.emplace_back([&] { event.wait(); });
+    }
+    for (auto& waiter : waiters) waiter.join();
+  });
+  const double process_ns = cpu_time_ns(RUSAGE_SELF) - process_start;
+
+  benchmark_common::report(std::to_string(waiter_count) +
+                               " threads in event::wait, process CPU time",
+                           process_ns / wall_ns * 100.0, "% of wall time");
+}
+
+/** @brief Measures the time from the kernel completion observed by a polling
+ *         thread until the wait returns
+ */
+void run_wake_up_latency(sycl::queue& queue, buffer_t& buffer,
+                         unsigned iterations) {
+  using benchmark_common::clock;
+  for (const auto& strategy : get_strategies()) {
+    if (!strategy.wakes_up_on_completion) continue;
+    sycl::event event = submit_long_kernel(queue, buffer, iterations);
+    std::atomic<bool> done{false};
+    clock::time_point completed{};
+    std::thread poller([&] {
+      while (!done.load()) {
+        if (event.get_info<sycl::info::event::command_execution_status>() ==
+            sycl::info::event_command_status::complete) {
+          completed = clock::now();
+          return;
+        }
+        // Leave the core to the waiting thread and the runtime, so that the
+        // poller does not delay the wake-up it measures
+        std::this_thread::yield();
+      }
+    });
+    strategy.wait(queue, event, buffer);
+    const auto returned = clock::now();
+    done = true;
+    poller.join();
+
+    // The poller might only observe the completion after the wait returned,
+    // if it was descheduled; such samples carry no information
+    if (completed == clock::time_point{} || completed > returned) {
+      WARN(strategy.name << ": completion was not observed before the wait "
+                            "returned");
+      continue;
+    }
+    benchmark_common::report(
+        strategy.name + ", wake-up latency",
+        std::chrono::duration<double, std::micro>(returned - completed).count(),
+        "us");
+  }
+}
+
+TEST_CASE("Host CPU usage while waiting for device work",
+          "[benchmark][queue][event]") {
+  auto queue = once_per_unit::get_queue();
+  buffer_t buffer{sycl::range<1>{work_items}};
+  {
+    sycl::host_accessor acc{buffer, sycl::write_only};
+    for (auto& value : acc) value = 1.0f;
+  }
+  const unsigned iterations = calibrate(queue, buffer);
+  INFO("kernel loop iterations: " << iterations);
+
+  SECTION("CPU usage") { run_cpu_usage(queue, buffer, iterations); }
+  SECTION("multiple waiters") {
+    run_multiple_waiters(queue, buffer, iterations);
+  }
+  SECTION("wake-up latency") {
+    run_wake_up_latency(queue, buffer, iterations);
+  }
+}
+
+#else
+
+TEST_CASE("Host CPU usage while waiting for device work",
+          "[benchmark][queue][event]") {
+  SKIP("Per-thread CPU time is only queried on Linux");
+}
+
+#endif  // defined(__linux__)
+
+}  // namespace benchmark_host_wait_cpu_usage
@@ -0,0 +1,310 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the overhead of index queries called in an inner
+//  loop, compared to the same indices computed once per work-item, for 1, 2
+//  and 3 dimensional launches of:
+//   - range, using item::get_linear_id, get_id and get_range
+//   - range with offset, using item::get_linear_id, get_id and get_offset, if
+//     deprecated features are enabled
+//   - nd_range, using nd_item::get_global_linear_id, get_local_linear_id,
+//     get_group_linear_id, get_global_id, get_local_id and get_group
+//   - hierarchical parallel_for_work_group, using the linear ids of
+//     h_item::get_global and get_local, and h_item::get_global_id and
+//     get_local_id
+//  Every iteration queries the dimension selected by the running sum and by
+//  a zero read from device memory at an index depending on that sum, so that
+//  the loop cannot be reduced to the precomputed version at compile time.
+//  Query times noticeably above the precomputed indices show the overhead of
+//  the queries themselves, e.g. of the linearization or offset handling.
+//
+*******************************************************************************/
+
+#include "../common/assertions.h"
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace benchmark_index_query_overhead {
+using namespace sycl_cts;
+
+constexpr int inner_iterations = 256;
+constexpr int repetitions = 5;
+// Queries slower than the precomputed indices by more than this factor are
+// reported
+constexpr double tolerated_slowdown = 1.1;
+
+enum class launch { range, range_with_offset, nd_range, hierarchical };
+
+inline const char* to_string(launch l) {
+  switch (l) {
+    case launch::range:
+      return "range";
+    case launch::range_with_offset:
+      return "range with offset";
+    case launch::nd_range:
+      return "nd_range";
+    default:
+      return "hierarchical";
+  }
+}
+
+template <int Dims, launch Launch, bool Precomputed>
+class index_kernel;
+
+/** @brief Launch sizes with about one million work-items in total
+ */
+template <int Dims>
+sycl::range<Dims> get_global_range() {
+  if constexpr (Dims == 1) {
+    return {1 << 20};
+  } else if constexpr (Dims == 2) {
+    return {1024, 1024};
+  } else {
+    return {128, 128, 64};
+  }
+}
+
+template <int Dims>
+sycl::range<Dims> get_local_range() {
+  if constexpr (Dims == 1) {
+    return {256};
+  } else if constexpr (Dims == 2) {
+    return {16, 16};
+  } else {
+    return {8, 8, 4};
+  }
+}
+
+template <int Dims>
+sycl::id<Dims> get_offset() {
+  if constexpr (Dims == 1) {
+    return {3};
+  } else if constexpr (Dims == 2) {
+    return {3, 5};
+  } else {
+    return {3, 5, 7};
+  }
+}
+
+template <int Dims>
+size_t linearize(const sycl::id<Dims>& id, const sycl::range<Dims>& range) {
+  size_t linear = 0;
+  for (int d = 0; d < Dims; ++d) linear = linear * range[d] + id[d];
+  return linear;
+}
+
+/** @brief Inner loop shared by all kernels
+ *  @param zeros Zeros read at an index depending on the running sum, opaque
+ *         to the compiler
+ *  @param value_of Provides the index value for the dimension given
+ */
+template <int Dims, typename ZerosT, typename ValueT>
+unsigned run_loop(const ZerosT& zeros, const ValueT& value_of) {
+  unsigned sum = 0;
+  for (int i = 0; i < inner_iterations; ++i) {
+    const unsigned zero = zeros[sum % inner_iterations];
+    const int dimension = static_cast<int>((sum + zero) % Dims);
+    sum = sum * 31u + static_cast<unsigned>(value_of(dimension) + zero) + i;
+  }
+  return sum;
+}
+
+template <int Dims, launch Launch, bool Precomputed>
+void submit(sycl::queue& queue, sycl::buffer<unsigned, 1>& zero_values,
+            sycl::buffer<unsigned, 1>& results) {
+  const auto global = get_global_range<Dims>();
+  const auto local = get_local_range<Dims>();
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor zeros{zero_values, cgh, sycl::read_only};
+        sycl::accessor out{results, cgh, sycl::write_only, sycl::no_init};
+        using kernel_name = index_kernel<Dims, Launch, Precomputed>;
+
+        if constexpr (Launch == launch::range) {
+          cgh.parallel_for<kernel_name>(global, [=](sycl::item<Dims> item) {
+            const sycl::id<Dims> id = item.get_id();
+            const sycl::range<Dims> range = item.get_range();
+            const size_t linear = linearize(id, range);
+            size_t values[Dims];
+            for (int d = 0; d < Dims; ++d) {
+              values[d] = linear + id[d] + range[d];
+            }
+            out[linear] =
+                Precomputed
+                    ? run_loop<Dims>(zeros, [&](int d) { return values[d]; })
+                    : run_loop<Dims>(zeros, [&](int d) {
+                        return item.get_linear_id() + item.get_id(d) +
+                               item.get_range(d);
+                      });
+          });
+#if SYCL_CTS_ENABLE_DEPRECATED_FEATURES_TESTS
+        } else if constexpr (Launch == launch::range_with_offset) {
+          // Offsets are deprecated in SYCL 2020
+          cgh.parallel_for<kernel_name>(
+              global, get_offset<Dims>(), [=](sycl::item<Dims, true> item) {
+                const sycl::id<Dims> id = item.get_id();
+                const sycl::id<Dims> offset = item.get_offset();
+                const size_t linear = linearize(id - offset, item.get_range());
+                size_t values[Dims];
+                for (int d = 0; d < Dims; ++d) {
+                  values[d] = linear + id[d] + offset[d];
+                }
+                out[linear] =
+                    Precomputed
+                        ? run_loop<Dims>(zeros,
+                                         [&](int d) { return values[d]; })
+                        : run_loop<Dims>(zeros, [&](int d) {
+                            return item.get_linear_id() + item.get_id(d) +
+                                   item.get_offset()[d];
+                          });
+              });
+#endif
+        } else if constexpr (Launch == launch::nd_range) {
+          cgh.parallel_for<kernel_name>(
+              sycl::nd_range<Dims>{global, local},
+              [=](sycl::nd_item<Dims> item) {
+                const sycl::id<Dims> global_id = item.get_global_id();
+                const sycl::id<Dims> local_id = item.get_local_id();
+                const sycl::id<Dims> group_id = item.get_group().get_group_id();
+                const size_t global_linear =
+                    linearize(global_id, item.get_global_range());
+                const size_t linear =
+                    global_linear +
+                    linearize(local_id, item.get_local_range()) +
+                    linearize(group_id, item.get_group_range());
+                size_t values[Dims];
+                for (int d = 0; d < Dims; ++d) {
+                  values[d] = linear + global_id[d] + local_id[d] + group_id[d];
+                }
+                out[global_linear] =
+                    Precomputed
+                        ? run_loop<Dims>(zeros,
+                                         [&](int d) { return values[d]; })
+                        : run_loop<Dims>(zeros, [&](int d) {
+                            return item.get_global_linear_id() +
+                                   item.get_local_linear_id() +
+                                   item.get_group_linear_id() +
+                                   item.get_global_id(d) +
+                                   item.get_local_id(d) + item.get_group(d);
+                          });
+              });
+        } else {
+          cgh.parallel_for_work_group<kernel_name>(
+              global / local, local, [=](sycl::group<Dims> group) {
+                group.parallel_for_work_item([&](sycl::h_item<Dims> item) {
+                  const sycl::item<Dims, false> global_item = item.get_global();
+                  const sycl::item<Dims, false> local_item = item.get_local();
+                  const sycl::id<Dims> global_id = global_item.get_id();
+                  const sycl::id<Dims> local_id = local_item.get_id();
+                  const size_t global_linear =
+                      linearize(global_id, global_item.get_range());
+                  const size_t linear =
+                      global_linear +
+                      linearize(local_id, local_item.get_range());
+                  size_t values[Dims];
+                  for (int d = 0; d < Dims; ++d) {
+                    values[d] = linear + global_id[d] + local_id[d];
+                  }
+                  out[global_linear] =
+                      Precomputed
+                          ? run_loop<Dims>(zeros,
+                                           [&](int d) { return values[d]; })
+                          : run_loop<Dims>(zeros, [&](int d) {
+                              return item.get_global().get_linear_id() +
+                                     item.get_local().get_linear_id() +
+                                     item.get_global_id(d) +
+                                     item.get_local_id(d);
+                            });
+                });
+              });
+        }
+      })
+      .wait_and_throw();
+}
+
+/** @brief Provides the fastest of several runs of the kernel, in nanoseconds
+ */
+template <int Dims, launch Launch, bool Precomputed>
+double measure(sycl::queue& queue, sycl::buffer<unsigned, 1>& zero_values,
+               sycl::buffer<unsigned, 1>& results) {
+  return benchmark_common::best_of_ns(repetitions, [&] {
+    submit<Dims, Launch, Precomputed>(queue, zero_values, results);
+  });
+}
+
+template <int Dims, launch Launch>
+void compare(sycl::queue& queue) {
+  const size_t count = get_global_range<Dims>().size();
+  const std::string name = std::to_string(Dims) + "D " + to_string(Launch);
+  sycl::buffer<unsigned, 1> results{sycl::range<1>{count}};
+  std::vector<unsigned> zeros(inner_iterations, 0);
+  sycl::buffer<unsigned, 1> zero_values{zeros.data(),
+                                        sycl::range<1>{zeros.size()}};
+
+  const double precomputed_ns =
+      measure<Dims, Launch, true>(queue, zero_values, results);
+  std::vector<unsigned> expected(count);
+  {
+    sycl::host_accessor acc{results, sycl::read_only};
+    std::copy(acc.begin(), acc.end(), expected.begin());
+  }
+  const double query_ns =
+      measure<Dims, Launch, false>(queue, zero_values, results);
+  {
+    sycl::host_accessor acc{results, sycl::read_only};
+    INFO(name << ": index queries vs. precomputed indices");
+    CHECK_ALL_EQUAL(count, acc.get_pointer(), expected.data());
+  }
+
+  const double per_query = (query_ns - precomputed_ns) /
+                           (static_cast<double>(count) * inner_iterations);
+  benchmark_common::report(name + ", precomputed indices",
+                           precomputed_ns / 1e6, "ms");
+  benchmark_common::report(name + ", index queries in the inner loop",
+                           query_ns / 1e6, "ms");
+  benchmark_common::report(name + ", overhead per loop iteration", per_query,
+                           "ns");
+  benchmark_common::report_ratio(
+      name + ", index queries vs. precomputed indices", query_ns,
+      precomputed_ns, tolerated_slowdown,
+      name + ": index queries are slower than precomputed indices");
+}
+
+template <int Dims>
+void run_launches(sycl::queue& queue) {
+  compare<Dims, launch::range>(queue);
+#if SYCL_CTS_ENABLE_DEPRECATED_FEATURES_TESTS
+  compare<Dims, launch::range_with_offset>(queue);
+#endif
+  compare<Dims, launch::nd_range>(queue);
+  compare<Dims, launch::hierarchical>(queue);
+}
+
+TEST_CASE("Index query overhead in inner loops",
+          "[benchmark][item][nd_item][h_item]") {
+  auto queue = once_per_unit::get_queue();
+
+  SECTION("1D") { run_launches<1>(queue); }
+  SECTION("2D") { run_launches<2>(queue); }
+  SECTION("3D") { run_launches<3>(queue); }
+}
+
+}  // namespace benchmark_index_query_overhead
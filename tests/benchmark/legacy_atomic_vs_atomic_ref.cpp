@@ -0,0 +1,253 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the deprecated sycl::atomic API, used through
+//  access_mode::atomic accessors, against sycl::atomic_ref with relaxed
+//  memory order. Both run identical contention patterns:
+//   - single counter: all work-items increment the same counter
+//   - histogram: work-items increment pseudo-random bins out of a few
+//   - striped: work-items increment their own stripe out of many
+//  for 32-bit and 64-bit integers in global and local memory. Local
+//  counters are flushed to global memory through the same API at the end of
+//  each work-group.
+//
+*******************************************************************************/
+
+#include "../common/assertions.h"
+#include "benchmark_common.h"
+
+#include <string>
+#include <vector>
+
+namespace benchmark_legacy_atomic_vs_atomic_ref {
+using namespace sycl_cts;
+
+using sycl::access::address_space;
+
+constexpr size_t work_items = 1 << 18;
+constexpr size_t group_size = 256;
+constexpr int ops_per_item = 64;
+constexpr int repetitions = 5;
+// atomic_ref slower than the legacy API by more than this factor is reported
+constexpr double tolerated_slowdown = 1.05;
+
+enum class api { legacy_atomic, atomic_ref };
+enum class pattern { single_counter, histogram, striped };
+
+inline const char* to_string(api a) {
+  return a == api::legacy_atomic ? "sycl::atomic" : "sycl::atomic_ref";
+}
+
+inline const char* to_string(pattern p) {
+  switch (p) {
+    case pattern::single_counter:
+      return "single counter";
+    case pattern::histogram:
+      return "histogram";
+    default:
+      return "striped";
+  }
+}
+
+template <pattern Pattern>
+constexpr size_t bin_count() {
+  if constexpr (Pattern == pattern::single_counter) {
+    return 1;
+  } else if constexpr (Pattern == pattern::histogram) {
+    return 64;
+  } else {
+    return 1024;
+  }
+}
+
+/** @brief Provides the counter incremented by the operation given; used on
+ *         host and device
+ */
+template <pattern Pattern>
+size_t bin_of(size_t id, int op) {
+  if constexpr (Pattern == pattern::single_counter) {
+    return 0;
+  } else if constexpr (Pattern == pattern::histogram) {
+    return (id * 2654435761u + static_cast<size_t>(op) * 40503u) %
+           bin_count<Pattern>();
+  } else {
+    return id % bin_count<Pattern>();
+  }
+}
+
+template <api Api, typename T, address_space Space, pattern Pattern>
+class atomic_kernel;
+
+template <api Api, address_space Space, typename AccT, typename T>
+void atomic_add(const AccT& acc, size_t index, T value) {
+  if constexpr (Api == api::legacy_atomic) {
+    acc[index].fetch_add(value);
+  } else {
+    constexpr auto scope = Space == address_space::global_space
+                               ? sycl::memory_scope::device
+                               : sycl::memory_scope::work_group;
+    sycl::atomic_ref<T, sycl::memory_order::relaxed, scope, Space> ref{
+        acc[index]};
+    ref.fetch_add(value);
+  }
+}
+
+template <api Api, typename T>
+auto make_global_accessor(sycl::buffer<T, 1>& counters, sycl::handler& cgh) {
+  if constexpr (Api == api::legacy_atomic) {
+    return counters.template get_access<sycl::access_mode::atomic>(cgh);
+  } else {
+    return sycl::accessor{counters, cgh, sycl::read_write};
+  }
+}
+
+template <api Api, typename T>
+auto make_local_accessor(size_t count, sycl::handler& cgh) {
+  if constexpr (Api == api::legacy_atomic) {
+    return sycl::accessor<T, 1, sycl::access_mode::atomic,
+                          sycl::target::local>(sycl::range<1>{count}, cgh);
+  } else {
+    return sycl::local_accessor<T, 1>(sycl::range<1>{count}, cgh);
+  }
+}
+
+template <api Api, typename T, address_space Space, pattern Pattern>
+void submit(sycl::queue& queue, sycl::buffer<T, 1>& counters) {
+  constexpr size_t bins = bin_count<Pattern>();
+  queue
+      .submit([&](sycl::handler& cgh) {
+        auto global = make_global_accessor<Api>(counters, cgh);
+        auto local = make_local_accessor<Api, T>(bins, cgh);
+        cgh.parallel_for<atomic_kernel<Api, T, Space, Pattern>>(
+            sycl::nd_range<1>{work_items, group_size},
+            [=](sycl::nd_item<1> item) {
+              const size_t id = item.get_global_id(0);
+              if constexpr (Space == address_space::global_space) {
+                for (int op = 0; op < ops_per_item; ++op) {
+                  atomic_add<Api, Space>(global, bin_of<Pattern>(id, op), T{1});
+                }
+              } else {
+                const size_t lid = item.get_local_id(0);
+                for (size_t b = lid; b < bins; b += group_size) {
+                  if constexpr (Api == api::legacy_atomic) {
+                    local[b].store(T{0});
+                  } else {
+                    local[b] = T{0};
+                  }
+                }
+                sycl::group_barrier(item.get_group());
+                for (int op = 0; op < ops_per_item; ++op) {
+                  atomic_add<Api, Space>(local, bin_of<Pattern>(id, op), T{1});
+                }
+                sycl::group_barrier(item.get_group());
+                for (size_t b = lid; b < bins; b += group_size) {
+                  T value;
+                  if constexpr (Api == api::legacy_atomic) {
+                    value = local[b].load();
+                  } else {
+                    value = local[b];
+                  }
+                  atomic_add<Api, address_space::global_space>(global, b,
+                                                               value);
+                }
+              }
+            });
+      })
+      .wait_and_throw();
+}
+
+template <typename T>
+void reset(sycl::queue& queue, sycl::buffer<T, 1>& counters) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{counters, cgh, sycl::write_only, sycl::no_init};
+        cgh.fill(acc, T{0});
+      })
+      .wait_and_throw();
+}
+
+/** @brief Provides the fastest of several runs of the kernel, in nanoseconds
+ */
+template <api Api, typename T, address_space Space, pattern Pattern>
+double measure(sycl::queue& queue, const std::string& name) {
+  constexpr size_t bins = bin_count<Pattern>();
+  sycl::buffer<T, 1> counters{sycl::range<1>{bins}};
+
+  std::vector<T> expected(bins, T{0});
+  for (size_t id = 0; id < work_items; ++id) {
+    for (int op = 0; op < ops_per_item; ++op) {
+      ++expected[bin_of<Pattern>(id, op)];
+    }
+  }
+
+  const double best_ns = benchmark_common::best_of_ns(
+      repetitions, [&] { submit<Api, T, Space, Pattern>(queue, counters); },
+      [&] { reset(queue, counters); },
+      [&] {
+        sycl::host_accessor acc{counters, sycl::read_only};
+        INFO(name << " through " << to_string(Api));
+        CHECK_ALL_EQUAL(bins, acc.get_pointer(), expected.data());
+      });
+
+  benchmark_common::report(name + ", " + to_string(Api),
+                           work_items * ops_per_item / best_ns,
+                           "G atomic ops/s");
+  return best_ns;
+}
+
+template <typename T, address_space Space, pattern Pattern>
+void compare(sycl::queue& queue, const std::string& type_name) {
+  const std::string name =
+      std::string(to_string(Pattern)) + ", " + type_name + ", " +
+      (Space == address_space::global_space ? "global" : "local") + " memory";
+  const double legacy_ns =
+      measure<api::legacy_atomic, T, Space, Pattern>(queue, name);
+  const double ref_ns =
+      measure<api::atomic_ref, T, Space, Pattern>(queue, name);
+
+  benchmark_common::report_ratio(
+      name + ", atomic_ref vs. legacy atomic", ref_ns, legacy_ns,
+      tolerated_slowdown,
+      name + ": relaxed atomic_ref is slower than the legacy sycl::atomic");
+}
+
+template <typename T, address_space Space>
+void run_patterns(sycl::queue& queue, const std::string& type_name) {
+  compare<T, Space, pattern::single_counter>(queue, type_name);
+  compare<T, Space, pattern::histogram>(queue, type_name);
+  compare<T, Space, pattern::striped>(queue, type_name);
+}
+
+TEMPLATE_TEST_CASE_SIG("Legacy sycl::atomic vs. atomic_ref",
+                       "[benchmark][atomic][atomic_ref]", ((typename T), T),
+                       int, long long) {
+  auto queue = once_per_unit::get_queue();
+  const std::string type_name = sizeof(T) == 8 ? "64-bit" : "32-bit";
+  if (sizeof(T) == 8 && !queue.get_device().has(sycl::aspect::atomic64)) {
+    SKIP("Device does not support 64-bit atomics");
+  }
+
+  SECTION("global memory") {
+    run_patterns<T, address_space::global_space>(queue, type_name);
+  }
+  SECTION("local memory") {
+    run_patterns<T, address_space::local_space>(queue, type_name);
+  }
+}
+
+}  // namespace benchmark_legacy_atomic_vs_atomic_ref
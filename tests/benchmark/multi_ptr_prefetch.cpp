@@ -0,0 +1,254 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the effect of multi_ptr::prefetch on:
+//   - streaming: sequential reads of a contiguous block per work-item
+//   - gather: reads through a random index array
+//   - pointer chasing: walks of a random cycle, prefetching through jump
+//     pointers to the node the given distance ahead
+//  Each kernel runs without prefetch and with several prefetch distances,
+//  over working sets from below to well beyond the last level cache. The
+//  speedup over the kernel without prefetch is reported, along with whether
+//  prefetch had a measurable effect at all.
+//
+*******************************************************************************/
+
+#include "../common/assertions.h"
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace benchmark_multi_ptr_prefetch {
+using namespace sycl_cts;
+
+constexpr size_t work_items = 4096;
+constexpr int repetitions = 3;
+// Prefetch distances in elements, or in nodes for pointer chasing
+constexpr size_t prefetch_distances[] = {4, 16, 64, 256};
+// Speedups beyond this factor are considered a measurable effect
+constexpr double measurable_speedup = 1.05;
+// Used if the device does not report its cache size
+constexpr size_t fallback_cache_bytes = 32 * 1024 * 1024;
+
+enum class pattern { streaming, gather, pointer_chasing };
+
+inline const char* to_string(pattern p) {
+  switch (p) {
+    case pattern::streaming:
+      return "streaming";
+    case pattern::gather:
+      return "gather";
+    default:
+      return "pointer chasing";
+  }
+}
+
+template <pattern Pattern, bool Prefetch>
+class prefetch_kernel;
+
+using global_ptr_t =
+    sycl::multi_ptr<const unsigned, sycl::access::address_space::global_space,
+                    sycl::access::decorated::no>;
+
+struct working_set {
+  size_t elements;
+  sycl::buffer<unsigned, 1> data;
+  // Random indices for gather, successors in a random cycle for pointer
+  // chasing
+  sycl::buffer<unsigned, 1> links;
+  // Node the prefetch distance ahead of each node in the cycle
+  sycl::buffer<unsigned, 1> jumps;
+  sycl::buffer<unsigned, 1> results{sycl::range<1>{work_items}};
+  std::vector<unsigned> cycle_order;
+
+  explicit working_set(size_t count)
+      : elements(count),
+        data(sycl::range<1>{count}),
+        links(sycl::range<1>{count}),
+        jumps(sycl::range<1>{count}),
+        cycle_order(count) {
+    std::mt19937 generator(count);
+    // Sattolo's algorithm provides a single cycle over all nodes
+    std::iota(cycle_order.begin(), cycle_order.end(), 0u);
+    for (size_t i = count - 1; i > 0; --i) {
+      std::uniform_int_distribution<size_t> pick(0, i - 1);
+      std::swap(cycle_order[i], cycle_order[pick(generator)]);
+    }
+    sycl::host_accessor values{data, sycl::write_only};
+    for (size_t i = 0; i < count; ++i) values[i] = static_cast<unsigned>(i);
+  }
+
+  void set_links(pattern p) {
+    sycl::host_accessor acc{links, sycl::write_only};
+    if (p == pattern::gather) {
+      std::mt19937 generator(elements + 1);
+      std::uniform_int_distribution<unsigned> pick(
+          0, static_cast<unsigned>(elements - 1));
+      for (size_t i = 0; i < elements; ++i) acc[i] = pick(generator);
+    } else {
+      for (size_t k = 0; k < elements; ++k) {
+        acc[cycle_order[k]] = cycle_order[(k + 1) % elements];
+      }
+    }
+  }
+
+  void set_jumps(size_t distance) {
+    sycl::host_accessor acc{jumps, sycl::write_only};
+    for (size_t k = 0; k < elements; ++k) {
+      acc[cycle_order[k]] = cycle_order[(k + distance) % elements];
+    }
+  }
+};
+
+template <pattern Pattern, bool Prefetch>
+void submit(sycl::queue& queue, working_set& set, size_t distance) {
+  const size_t per_item = set.elements / work_items;
+  const size_t elements = set.elements;
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor data{set.data, cgh, sycl::read_only};
+        sycl::accessor links{set.links, cgh, sycl::read_only};
+        sycl::accessor jumps{set.jumps, cgh, sycl::read_only};
+        sycl::accessor results{set.results, cgh, sycl::write_only,
+                               sycl::no_init};
+        cgh.parallel_for<prefetch_kernel<Pattern, Prefetch>>(
+            sycl::range<1>{work_items}, [=](sycl::id<1> id) {
+              const global_ptr_t ptr =
+                  data.template get_multi_ptr<sycl::access::decorated::no>();
+              const size_t begin = id[0] * per_item;
+              const size_t end = begin + per_item;
+              unsigned sum = 0;
+              if constexpr (Pattern == pattern::streaming) {
+                for (size_t i = begin; i < end; ++i) {
+                  // Once per 64-byte line
+                  if (Prefetch && i % 16 == 0 && i + distance < elements) {
+                    (ptr + i + distance).prefetch(16);
+                  }
+                  sum += ptr[i];
+                }
+              } else if constexpr (Pattern == pattern::gather) {
+                for (size_t i = begin; i < end; ++i) {
+                  if (Prefetch && i + distance < end) {
+                    (ptr + links[i + distance]).prefetch(1);
+                  }
+                  sum += ptr[links[i]];
+                }
+              } else {
+                // Each work-item walks the cycle from a different node
+                size_t node = links[begin];
+                for (size_t step = 0; step < per_item; ++step) {
+                  if (Prefetch) (ptr + jumps[node]).prefetch(1);
+                  sum += ptr[node];
+                  node = links[node];
+                }
+              }
+              results[id] = sum;
+            });
+      })
+      .wait_and_throw();
+}
+
+/** @brief Provides the fastest of several runs of the kernel, in nanoseconds
+ */
+template <pattern Pattern, bool Prefetch>
+double measure(sycl::queue& queue, working_set& set, size_t distance) {
+  return benchmark_common::best_of_ns(
+      repetitions, [&] { submit<Pattern, Prefetch>(queue, set, distance); });
+}
+
+/** @brief Runs the pattern without and with prefetch
+ *  @retval Best speedup of prefetch over no prefetch
+ */
+template <pattern Pattern>
+double run_pattern(sycl::queue& queue, working_set& set) {
+  const std::string name = std::string(to_string(Pattern)) + ", " +
+                           std::to_string(set.elements * sizeof(unsigned)) +
+                           " bytes";
+  set.set_links(Pattern);
+  set.set_jumps(1);
+
+  const double baseline_ns = measure<Pattern, false>(queue, set, 0);
+  std::vector<unsigned> expected(work_items);
+  {
+    sycl::host_accessor results{set.results, sycl::read_only};
+    std::copy(results.begin(), results.end(), expected.begin());
+  }
+  benchmark_common::report(name + ", no prefetch",
+                           set.elements / baseline_ns, "G elements/s");
+
+  double best_speedup = 0.0;
+  for (const size_t distance : prefetch_distances) {
+    if (Pattern == pattern::pointer_chasing) set.set_jumps(distance);
+    const double ns = measure<Pattern, true>(queue, set, distance);
+    {
+      sycl::host_accessor results{set.results, sycl::read_only};
+      INFO(name << ", prefetch distance " << distance);
+      CHECK_ALL_EQUAL(work_items, results.get_pointer(), expected.data());
+    }
+    const double speedup = baseline_ns / ns;
+    best_speedup = std::max(best_speedup, speedup);
+    benchmark_common::report(
+        name + ", prefetch distance " + std::to_string(distance) + ", speedup",
+        speedup, "x");
+  }
+  return best_speedup;
+}
+
+TEST_CASE("multi_ptr::prefetch effectiveness",
+          "[benchmark][multi_ptr][prefetch]") {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  if (!device.is_cpu()) {
+    WARN("Prefetch effectiveness is primarily of interest for CPU devices");
+  }
+
+  size_t cache_bytes =
+      device.get_info<sycl::info::device::global_mem_cache_size>();
+  if (cache_bytes == 0) cache_bytes = fallback_cache_bytes;
+  const size_t max_bytes = static_cast<size_t>(
+      device.get_info<sycl::info::device::max_mem_alloc_size>());
+
+  bool measurable_beyond_cache = false;
+  for (const size_t factor : {1, 4, 16}) {
+    // Half of the cache size, then well beyond it
+    const size_t bytes = std::min(cache_bytes * factor / 2, max_bytes);
+    const size_t items_per_work_item = bytes / sizeof(unsigned) / work_items;
+    const size_t elements = std::max<size_t>(1, items_per_work_item) *
+                            work_items;
+    working_set set{elements};
+
+    const double speedup = std::max(
+        {run_pattern<pattern::streaming>(queue, set),
+         run_pattern<pattern::gather>(queue, set),
+         run_pattern<pattern::pointer_chasing>(queue, set)});
+    if (bytes > cache_bytes && speedup > measurable_speedup) {
+      measurable_beyond_cache = true;
+    }
+  }
+
+  WARN("multi_ptr::prefetch "
+       << (measurable_beyond_cache ? "has" : "has no")
+       << " measurable effect on working sets beyond the last level cache of "
+       << device.get_info<sycl::info::device::name>());
+}
+
+}  // namespace benchmark_multi_ptr_prefetch
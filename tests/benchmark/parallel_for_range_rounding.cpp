@@ -0,0 +1,212 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for parallel_for over global ranges that are not a
+//  multiple of any reasonable work-group size, comparing
+//    parallel_for(range, ...)
+//  with the user padding the range manually:
+//    parallel_for(nd_range(padded_range, local_range), ...)
+//  Both variants are also checked to execute every work-item exactly once.
+//
+*******************************************************************************/
+
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace benchmark_parallel_for_range_rounding {
+using namespace sycl_cts;
+
+using counter_t = unsigned int;
+
+/** @brief Provides global ranges with prime or otherwise awkward extents
+ */
+template <int Dims>
+std::vector<sycl::range<Dims>> get_global_ranges() {
+  if constexpr (Dims == 1) {
+    return {sycl::range<1>{999'983}, sycl::range<1>{1'048'583},
+            sycl::range<1>{10'000'019}};
+  } else if constexpr (Dims == 2) {
+    return {sycl::range<2>{1'021, 1'031}, sycl::range<2>{3'163, 3'167},
+            sycl::range<2>{7, 1'428'577}};
+  } else {
+    return {sycl::range<3>{101, 103, 107}, sycl::range<3>{211, 223, 227},
+            sycl::range<3>{3, 5, 666'667}};
+  }
+}
+
+/** @brief Provides a local range supported by the device to pad with
+ */
+template <int Dims>
+sycl::range<Dims> get_local_range(const sycl::device& device) {
+  sycl::range<Dims> local = [] {
+    if constexpr (Dims == 1)
+      return sycl::range<1>{256};
+    else if constexpr (Dims == 2)
+      return sycl::range<2>{16, 16};
+    else
+      return sycl::range<3>{4, 8, 8};
+  }();
+  const sycl::id<Dims> max_sizes =
+      device.get_info<sycl::info::device::max_work_item_sizes<Dims>>();
+  for (int i = 0; i < Dims; ++i) {
+    local[i] = std::max<size_t>(1, std::min(local[i], max_sizes[i]));
+  }
+  const size_t max_wg_size =
+      device.get_info<sycl::info::device::max_work_group_size>();
+  // Halve the largest extent until the local range fits the device
+  while (local.size() > max_wg_size) {
+    int largest = 0;
+    for (int i = 1; i < Dims; ++i) {
+      if (local[i] > local[largest]) largest = i;
+    }
+    local[largest] /= 2;
+  }
+  return local;
+}
+
+template <int Dims>
+sycl::range<Dims> round_up(const sycl::range<Dims>& global,
+                           const sycl::range<Dims>& local) {
+  sycl::range<Dims> result = global;
+  for (int i = 0; i < Dims; ++i) {
+    result[i] = (global[i] + local[i] - 1) / local[i] * local[i];
+  }
+  return result;
+}
+
+template <int Dims>
+size_t linearize(const sycl::id<Dims>& id, const sycl::range<Dims>& range) {
+  size_t result = 0;
+  for (int i = 0; i < Dims; ++i) {
+    result = result * range[i] + id[i];
+  }
+  return result;
+}
+
+template <int Dims>
+std::string to_string(const sycl::range<Dims>& range) {
+  std::string result = std::to_string(range[0]);
+  for (int i = 1; i < Dims; ++i) {
+    result += "x" + std::to_string(range[i]);
+  }
+  return result;
+}
+
+enum class launch { range, padded_nd_range };
+
+/** @brief Increments the counter of every work-item of the global range given
+ *  @param atomic Use atomic increments, so that duplicated work-items running
+ *         concurrently are counted reliably
+ */
+template <int Dims>
+void submit(sycl::queue& queue, sycl::buffer<counter_t, 1>& counters,
+            const sycl::range<Dims>& global, const sycl::range<Dims>& local,
+            launch kind, bool atomic) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{counters, cgh, sycl::read_write};
+        auto increment = [=](size_t index) {
+          if (atomic) {
+            sycl::atomic_ref<counter_t, sycl::memory_order::relaxed,
+                             sycl::memory_scope::device,
+                             sycl::access::address_space::global_space>
+                ref{acc[index]};
+            ref.fetch_add(1);
+          } else {
+            acc[index] += 1;
+          }
+        };
+        if (kind == launch::range) {
+          cgh.parallel_for(global, [=](sycl::item<Dims> item) {
+            increment(item.get_linear_id());
+          });
+        } else {
+          const sycl::nd_range<Dims> padded{round_up(global, local), local};
+          cgh.parallel_for(padded, [=](sycl::nd_item<Dims> item) {
+            const sycl::id<Dims> id = item.get_global_id();
+            for (int i = 0; i < Dims; ++i) {
+              if (id[i] >= global[i]) return;
+            }
+            increment(linearize(id, global));
+          });
+        }
+      })
+      .wait_and_throw();
+}
+
+/** @brief Checks that every work-item was executed exactly once
+ */
+template <int Dims>
+void verify(sycl::queue& queue, sycl::buffer<counter_t, 1>& counters,
+            const sycl::range<Dims>& global, const sycl::range<Dims>& local,
+            launch kind) {
+  {
+    sycl::host_accessor acc{counters, sycl::write_only};
+    std::fill(acc.begin(), acc.end(), counter_t{0});
+  }
+  submit(queue, counters, global, local, kind, true);
+
+  size_t dropped = 0;
+  size_t duplicated = 0;
+  sycl::host_accessor acc{counters, sycl::read_only};
+  for (size_t i = 0; i < global.size(); ++i) {
+    dropped += acc[i] == 0;
+    duplicated += acc[i] > 1;
+  }
+  INFO("dropped work-items: " << dropped
+                              << ", duplicated work-items: " << duplicated);
+  CHECK((dropped == 0 && duplicated == 0));
+}
+
+template <int Dims>
+void run_benchmarks() {
+  auto queue = once_per_unit::get_queue();
+  const auto local = get_local_range<Dims>(queue.get_device());
+
+  for (const auto& global : get_global_ranges<Dims>()) {
+    const std::string name = to_string(global);
+    INFO("global range " << name << ", local range " << to_string(local));
+    sycl::buffer<counter_t, 1> counters{sycl::range<1>{global.size()}};
+
+    verify(queue, counters, global, local, launch::range);
+    verify(queue, counters, global, local, launch::padded_nd_range);
+
+    const double padded_items =
+        static_cast<double>(round_up(global, local).size());
+    benchmark_common::report(
+        "manual padding overhead for " + name,
+        (padded_items / global.size() - 1.0) * 100.0, "% extra work-items");
+
+    BENCHMARK("range " + name) {
+      submit(queue, counters, global, local, launch::range, false);
+    };
+    BENCHMARK("padded nd_range " + name) {
+      submit(queue, counters, global, local, launch::padded_nd_range, false);
+    };
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "parallel_for over awkward global ranges, range vs. padded nd_range",
+    "[benchmark][parallel_for]", ((int Dims), Dims), 1, 2, 3) {
+  run_benchmarks<Dims>();
+}
+
+}  // namespace benchmark_parallel_for_range_rounding
@@ -0,0 +1,215 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for queues with property::queue::enable_profiling:
+//   - kernel submission and copy throughput of profiled vs. unprofiled queues
+//   - effective resolution and monotonicity of profiling timestamps, using
+//     back-to-back tiny kernels
+//   - latency of profiling info queries
+//
+*******************************************************************************/
+
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace benchmark_queue_profiling_overhead {
+using namespace sycl_cts;
+
+constexpr size_t kernel_count = 1000;
+constexpr size_t copy_elements = 4 * 1024 * 1024;
+
+class tiny_usm_kernel;
+class tiny_accessor_kernel;
+
+sycl::event submit_tiny_kernel(sycl::queue& queue, int* data) {
+  return queue.single_task<tiny_usm_kernel>([=] { *data += 1; });
+}
+
+void run_throughput(const sycl::device& device) {
+  for (const bool profiled : {false, true}) {
+    sycl::property_list properties;
+    if (profiled) {
+      properties =
+          sycl::property_list{sycl::property::queue::enable_profiling{}};
+    }
+    sycl::queue queue{device, properties};
+    const std::string name = profiled ? "profiled" : "unprofiled";
+
+    sycl::buffer<int, 1> counter{sycl::range<1>{1}};
+    sycl::buffer<float, 1> src{sycl::range<1>{copy_elements}};
+    sycl::buffer<float, 1> dst{sycl::range<1>{copy_elements}};
+    {
+      sycl::host_accessor acc{src, sycl::write_only};
+      std::fill(acc.begin(), acc.end(), 1.0f);
+    }
+
+    BENCHMARK(std::to_string(kernel_count) + " tiny kernels, " + name) {
+      for (size_t i = 0; i < kernel_count; ++i) {
+        queue.submit([&](sycl::handler& cgh) {
+          sycl::accessor acc{counter, cgh, sycl::read_write};
+          cgh.single_task<tiny_accessor_kernel>([=] { acc[0] += 1; });
+        });
+      }
+      queue.wait_and_throw();
+    };
+    BENCHMARK("copy of " + std::to_string(copy_elements * sizeof(float)) +
+              " bytes, " + name) {
+      queue
+          .submit([&](sycl::handler& cgh) {
+            sycl::accessor in{src, cgh, sycl::read_only};
+            sycl::accessor out{dst, cgh, sycl::write_only};
+            cgh.copy(in, out);
+          })
+          .wait_and_throw();
+    };
+
+    sycl::host_accessor acc{dst, sycl::read_only};
+    CHECK(acc[copy_elements - 1] == 1.0f);
+  }
+}
+
+/** @brief Submits back-to-back tiny kernels to an in-order profiled queue and
+ *         derives the timestamp resolution from the smallest non-zero
+ *         difference between timestamps
+ */
+void run_resolution(const sycl::device& device) {
+  sycl::queue queue{device,
+                    {sycl::property::queue::enable_profiling{},
+                     sycl::property::queue::in_order{}}};
+  int* data = sycl::malloc_device<int>(1, queue);
+  REQUIRE(data != nullptr);
+
+  std::vector<sycl::event> events;
+  events.reserve(kernel_count);
+  for (size_t i = 0; i < kernel_count; ++i) {
+    events.push_back(submit_tiny_kernel(queue, data));
+  }
+  queue.wait_and_throw();
+
+  struct timestamps {
+    uint64_t submit, start, end;
+  };
+  std::vector<timestamps> values;
+  for (auto& event : events) {
+    using namespace sycl::info;
+    values.push_back(
+        {event.get_profiling_info<event_profiling::command_submit>(),
+         event.get_profiling_info<event_profiling::command_start>(),
+         event.get_profiling_info<event_profiling::command_end>()});
+  }
+  sycl::free(data, queue);
+
+  size_t unordered = 0;
+  size_t overlapping = 0;
+  size_t zero_duration = 0;
+  uint64_t resolution = std::numeric_limits<uint64_t>::max();
+  auto update_resolution = [&](uint64_t earlier, uint64_t later) {
+    if (later > earlier) resolution = std::min(resolution, later - earlier);
+  };
+  for (size_t i = 0; i < values.size(); ++i) {
+    const auto& t = values[i];
+    unordered += !(t.submit <= t.start && t.start <= t.end);
+    zero_duration += t.start == t.end;
+    update_resolution(t.start, t.end);
+    if (i > 0) {
+      // In-order queue: the command must not start before the previous ended
+      overlapping += t.start < values[i - 1].end;
+      update_resolution(values[i - 1].start, t.start);
+      update_resolution(values[i - 1].end, t.end);
+    }
+  }
+
+  INFO("events with command_submit > command_start or "
+       "command_start > command_end: "
+       << unordered);
+  CHECK(unordered == 0);
+
+  benchmark_common::report("commands starting before the previous one ended",
+                           static_cast<double>(overlapping),
+                           "of " + std::to_string(kernel_count));
+  benchmark_common::report("commands with zero duration",
+                           static_cast<double>(zero_duration),
+                           "of " + std::to_string(kernel_count));
+  if (resolution != std::numeric_limits<uint64_t>::max()) {
+    benchmark_common::report("effective timestamp resolution",
+                             static_cast<double>(resolution), "ns");
+  }
+  const auto& first = values.front();
+  const auto& last = values.back();
+  benchmark_common::report(
+      "average interval between kernel starts",
+      static_cast<double>(last.start - first.start) / (kernel_count - 1),
+      "ns");
+  benchmark_common::report(
+      "average time per kernel from first start to last end",
+      static_cast<double>(last.end - first.start) / kernel_count, "ns");
+}
+
+void run_query_overhead(const sycl::device& device) {
+  sycl::queue queue{device, {sycl::property::queue::enable_profiling{}}};
+  int* data = sycl::malloc_device<int>(1, queue);
+  REQUIRE(data != nullptr);
+  sycl::event event = submit_tiny_kernel(queue, data);
+  event.wait_and_throw();
+
+  BENCHMARK("get_profiling_info<command_submit>") {
+    return event
+        .get_profiling_info<sycl::info::event_profiling::command_submit>();
+  };
+  BENCHMARK("get_profiling_info<command_start>") {
+    return event
+        .get_profiling_info<sycl::info::event_profiling::command_start>();
+  };
+  BENCHMARK("get_profiling_info<command_end>") {
+    return event.get_profiling_info<sycl::info::event_profiling::command_end>();
+  };
+  BENCHMARK("get_info<command_execution_status>") {
+    return event.get_info<sycl::info::event::command_execution_status>();
+  };
+
+  sycl::free(data, queue);
+}
+
+TEST_CASE("Profiling overhead and timestamp resolution",
+          "[benchmark][event][queue]") {
+  const auto device = once_per_unit::get_queue().get_device();
+  if (!device.has(sycl::aspect::queue_profiling)) {
+    SKIP("Device does not support queue profiling");
+  }
+
+  SECTION("throughput") { run_throughput(device); }
+  SECTION("resolution") {
+    if (!device.has(sycl::aspect::usm_device_allocations)) {
+      SKIP("Device does not support device USM allocations");
+    }
+    run_resolution(device);
+  }
+  SECTION("query overhead") {
+    if (!device.has(sycl::aspect::usm_device_allocations)) {
+      SKIP("Device does not support device USM allocations");
+    }
+    run_query_overhead(device);
+  }
+}
+
+}  // namespace benchmark_queue_profiling_overhead
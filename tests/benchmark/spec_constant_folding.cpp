@@ -0,0 +1,186 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the same filter kernel with the loop trip count and
+//  a branch selector provided as:
+//   - a compile-time template parameter
+//   - a specialization constant
+//   - a kernel argument
+//  Comparable timings of the first two variants, faster than the third,
+//  indicate that the implementation folds specialization constants. The time
+//  of the first submission with a new specialization constant value shows the
+//  cost of specializing the kernel.
+//
+*******************************************************************************/
+
+#include "../common/assertions.h"
+#include "../common/disabled_for_test_case.h"
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace benchmark_spec_constant_folding {
+using namespace sycl_cts;
+
+#ifndef SYCL_CTS_COMPILING_WITH_HIPSYCL
+
+constexpr size_t element_count = 1 << 22;
+constexpr int max_taps = 16;
+
+enum filter_mode : int { weighted_sum = 0, weighted_max = 1 };
+
+constexpr sycl::specialization_id<int> taps_spec{1};
+constexpr sycl::specialization_id<int> mode_spec{weighted_sum};
+
+template <int Taps, int Mode>
+class template_kernel;
+class spec_constant_kernel;
+class argument_kernel;
+
+template <typename InputT>
+int filter(const InputT& in, size_t i, int taps, int mode) {
+  int result = mode == weighted_sum ? 0 : std::numeric_limits<int>::min();
+  for (int t = 0; t < taps; ++t) {
+    const int value = in[i + t] * (t + 1);
+    result = mode == weighted_sum ? result + value : sycl::max(result, value);
+  }
+  return result;
+}
+
+struct buffers {
+  sycl::buffer<int, 1> in{sycl::range<1>{element_count + max_taps}};
+  sycl::buffer<int, 1> out{sycl::range<1>{element_count}};
+  std::vector<int> host_input;
+
+  buffers() : host_input(element_count + max_taps) {
+    for (size_t i = 0; i < host_input.size(); ++i) {
+      host_input[i] = static_cast<int>((i * 7919) % 201) - 100;
+    }
+    sycl::host_accessor acc{in, sycl::write_only};
+    std::copy(host_input.begin(), host_input.end(), acc.begin());
+  }
+};
+
+template <int Taps, int Mode>
+void submit_template(sycl::queue& queue, buffers& data) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor in{data.in, cgh, sycl::read_only};
+        sycl::accessor out{data.out, cgh, sycl::write_only};
+        cgh.parallel_for<template_kernel<Taps, Mode>>(
+            sycl::range<1>{element_count},
+            [=](sycl::id<1> i) { out[i] = filter(in, i[0], Taps, Mode); });
+      })
+      .wait_and_throw();
+}
+
+void submit_spec_constant(sycl::queue& queue, buffers& data, int taps,
+                          int mode) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor in{data.in, cgh, sycl::read_only};
+        sycl::accessor out{data.out, cgh, sycl::write_only};
+        cgh.set_specialization_constant<taps_spec>(taps);
+        cgh.set_specialization_constant<mode_spec>(mode);
+        cgh.parallel_for<spec_constant_kernel>(
+            sycl::range<1>{element_count},
+            [=](sycl::id<1> i, sycl::kernel_handler h) {
+              out[i] = filter(in, i[0],
+                              h.get_specialization_constant<taps_spec>(),
+                              h.get_specialization_constant<mode_spec>());
+            });
+      })
+      .wait_and_throw();
+}
+
+void submit_argument(sycl::queue& queue, buffers& data, int taps, int mode) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor in{data.in, cgh, sycl::read_only};
+        sycl::accessor out{data.out, cgh, sycl::write_only};
+        cgh.parallel_for<argument_kernel>(
+            sycl::range<1>{element_count},
+            [=](sycl::id<1> i) { out[i] = filter(in, i[0], taps, mode); });
+      })
+      .wait_and_throw();
+}
+
+void verify(buffers& data, int taps, int mode, const std::string& variant) {
+  sycl::host_accessor out{data.out, sycl::read_only};
+  INFO(variant << " with " << taps << " taps, mode " << mode);
+  CHECK_ALL(element_count, [&](size_t i) {
+    return out[i] == filter(data.host_input, i, taps, mode);
+  });
+}
+
+template <int Taps, int Mode>
+void run_benchmarks(sycl::queue& queue, buffers& data) {
+  const std::string suffix = ", " + std::to_string(Taps) + " taps, " +
+                             (Mode == weighted_sum ? "sum" : "max");
+
+  // First submission with a new value requires the kernel to be specialized
+  const double first_ns = benchmark_common::measure_ns(
+      [&] { submit_spec_constant(queue, data, Taps, Mode); });
+  verify(data, Taps, Mode, "specialization constant");
+  const double second_ns = benchmark_common::measure_ns(
+      [&] { submit_spec_constant(queue, data, Taps, Mode); });
+  benchmark_common::report("first submission with new specialization" + suffix,
+                           first_ns / 1e3, "us");
+  benchmark_common::report("second submission with same specialization" +
+                               suffix,
+                           second_ns / 1e3, "us");
+
+  submit_template<Taps, Mode>(queue, data);
+  verify(data, Taps, Mode, "template parameter");
+  submit_argument(queue, data, Taps, Mode);
+  verify(data, Taps, Mode, "kernel argument");
+
+  BENCHMARK("template parameter" + suffix) {
+    submit_template<Taps, Mode>(queue, data);
+  };
+  BENCHMARK("specialization constant" + suffix) {
+    submit_spec_constant(queue, data, Taps, Mode);
+  };
+  BENCHMARK("kernel argument" + suffix) {
+    submit_argument(queue, data, Taps, Mode);
+  };
+}
+
+template <int... Taps>
+void run_all(sycl::queue& queue, std::integer_sequence<int, Taps...>) {
+  buffers data;
+  (run_benchmarks<Taps, weighted_sum>(queue, data), ...);
+  (run_benchmarks<Taps, weighted_max>(queue, data), ...);
+}
+
+#endif  // !SYCL_CTS_COMPILING_WITH_HIPSYCL
+
+// FIXME: re-enable when support for specialization constants is implemented
+//        in hipSYCL
+DISABLED_FOR_TEST_CASE(hipSYCL)
+("Specialization constant vs. kernel argument vs. template parameter",
+ "[benchmark][spec_constants]")({
+  auto queue = once_per_unit::get_queue();
+  run_all(queue, std::integer_sequence<int, 3, 7, max_taps>{});
+});
+
+}  // namespace benchmark_spec_constant_folding
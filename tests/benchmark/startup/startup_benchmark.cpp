@@ -0,0 +1,394 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides a benchmark for the SYCL runtime startup latency. Unlike the
+//  other benchmarks, it is a standalone executable: every repetition runs in
+//  a fresh process, so each phase is measured cold:
+//   - platform::get_platforms
+//   - device::get_devices
+//   - context construction
+//   - queue construction
+//   - first malloc_device
+//   - first kernel submission, including JIT compilation if any
+//   - second kernel submission, as a warm reference
+//   - platform and device info queries, as done for --info-dump
+//
+//  Usage:
+//    startup_benchmark [--device <regex>] [--repetitions <count>]
+//                      [--output <file>] [--history <file>]
+//  The device is selected like for the test executables, by matching the
+//  regular expression against "<platform name> / <device name>". The default
+//  selector is used if no device is given.
+//  The summary is written as JSON to the output file or to stdout. With
+//  --history, the summary is also appended as a single line to the file
+//  given, so that results can be tracked across implementation versions.
+//
+*******************************************************************************/
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#include <windows.h>
+#else
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+class startup_kernel;
+
+/** @brief Provides the first of the devices given matching the regular
+ *         expression, or the device chosen by the default selector if the
+ *         expression is empty
+ */
+std::optional<sycl::device> select_device(
+    const std::vector<sycl::device>& devices, const std::string& device_regex) {
+  if (device_regex.empty()) return sycl::device{sycl::default_selector_v};
+  const std::regex regex{device_regex};
+  for (const auto& device : devices) {
+    const auto platform_name =
+        device.get_platform().get_info<sycl::info::platform::name>();
+    const auto device_name = device.get_info<sycl::info::device::name>();
+    if (std::regex_search(platform_name + " / " + device_name, regex)) {
+      return device;
+    }
+  }
+  return std::nullopt;
+}
+
+/** @brief Runs all phases in the current process and prints the duration of
+ *         each of them in microseconds, one "<phase> <duration>" per line
+ */
+int run_phases(const std::string& device_regex) {
+  auto phase = [](const char* name, auto&& action) {
+    const auto start = clock::now();
+    action();
+    const auto end = clock::now();
+    std::printf("%s %.3f\n", name,
+                std::chrono::duration<double, std::micro>(end - start).count());
+  };
+
+  std::vector<sycl::platform> platforms;
+  phase("get_platforms", [&] { platforms = sycl::platform::get_platforms(); });
+
+  std::vector<sycl::device> devices;
+  phase("get_devices", [&] { devices = sycl::device::get_devices(); });
+  if (devices.empty()) {
+    std::fprintf(stderr, "No devices available\n");
+    return EXIT_FAILURE;
+  }
+  const auto selected = select_device(devices, device_regex);
+  if (!selected) {
+    std::fprintf(stderr, "No device matches \"%s\"\n", device_regex.c_str());
+    return EXIT_FAILURE;
+  }
+  const sycl::device device = *selected;
+
+  std::unique_ptr<sycl::context> context;
+  phase("context_construction",
+        [&] { context = std::make_unique<sycl::context>(device); });
+
+  std::unique_ptr<sycl::queue> queue;
+  phase("queue_construction",
+        [&] { queue = std::make_unique<sycl::queue>(*context, device); });
+
+  int* data = nullptr;
+  if (device.has(sycl::aspect::usm_device_allocations)) {
+    phase("first_malloc_device",
+          [&] { data = sycl::malloc_device<int>(1, *queue); });
+  }
+
+  sycl::buffer<int, 1> buffer{sycl::range<1>{1}};
+  auto submit_kernel = [&] {
+    queue
+        ->submit([&](sycl::handler& cgh) {
+          sycl::accessor acc{buffer, cgh, sycl::write_only};
+          cgh.single_task<startup_kernel>([=] { acc[0] = 42; });
+        })
+        .wait_and_throw();
+  };
+  phase("first_kernel", submit_kernel);
+  phase("second_kernel", submit_kernel);
+
+  phase("info_queries", [&] {
+    const auto platform = device.get_platform();
+    // Same queries as done by device_manager::dump_info
+    static_cast<void>(device.get_info<sycl::info::device::name>());
+    static_cast<void>(device.get_info<sycl::info::device::vendor>());
+    static_cast<void>(device.get_info<sycl::info::device::device_type>());
+    static_cast<void>(device.get_info<sycl::info::device::version>());
+    static_cast<void>(device.has(sycl::aspect::fp16));
+    static_cast<void>(device.has(sycl::aspect::fp64));
+    static_cast<void>(device.has(sycl::aspect::atomic64));
+    static_cast<void>(platform.get_info<sycl::info::platform::name>());
+    static_cast<void>(platform.get_info<sycl::info::platform::vendor>());
+    static_cast<void>(platform.get_info<sycl::info::platform::version>());
+  });
+
+  if (data != nullptr) sycl::free(data, *queue);
+
+  sycl::host_accessor acc{buffer, sycl::read_only};
+  if (acc[0] != 42) {
+    std::fprintf(stderr, "Kernel did not produce the expected result\n");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+using samples_t = std::map<std::string, std::vector<double>>;
+
+/** @brief Provides the path of the running executable, or the name it was
+ *         invoked with if the path is not available
+ */
+std::string get_executable_path(const char* invoked_as) {
+#if defined(_WIN32)
+  char path[MAX_PATH];
+  const DWORD length = GetModuleFileNameA(nullptr, path, MAX_PATH);
+  if (length > 0 && length < MAX_PATH) return std::string(path, length);
+#elif defined(__linux__)
+  char path[4096];
+  const ssize_t length = readlink("/proc/self/exe", path, sizeof(path));
+  if (length > 0 && static_cast<size_t>(length) < sizeof(path)) {
+    return std::string(path, static_cast<size_t>(length));
+  }
+#endif
+  return invoked_as;
+}
+
+/** @brief Reads the "<phase> <duration>" lines printed by run_phases
+ */
+void read_samples(FILE* output, samples_t& samples) {
+  char line[256];
+  while (std::fgets(line, sizeof(line), output) != nullptr) {
+    std::istringstream stream(line);
+    std::string name;
+    double duration_us = 0;
+    if (stream >> name >> duration_us) samples[name].push_back(duration_us);
+  }
+}
+
+#if defined(_WIN32)
+/** @brief Quotes an argument, so that it is parsed back unchanged from the
+ *         command line built by _spawnv
+ */
+std::string quote_argument(const std::string& argument) {
+  std::string result = "\"";
+  size_t backslashes = 0;
+  for (const char c : argument) {
+    if (c == '\\') {
+      ++backslashes;
+      continue;
+    }
+    // Backslashes are only escaped if followed by a quote
+    result.append(c == '"' ? 2 * backslashes + 1 : backslashes, '\\');
+    result += c;
+    backslashes = 0;
+  }
+  result.append(2 * backslashes, '\\');
+  result += '"';
+  return result;
+}
+#endif
+
+/** @brief Runs the phases in a fresh child process and collects the durations
+ *  @details The arguments are passed as an array, without a shell
+ */
+bool run_child(const std::string& self, const std::string& device_regex,
+               samples_t& samples) {
+  std::vector<std::string> args{self, "--child"};
+  if (!device_regex.empty()) {
+    args.push_back("--device");
+    args.push_back(device_regex);
+  }
+
+#if defined(_WIN32)
+  std::vector<std::string> quoted;
+  for (const auto& arg : args) quoted.push_back(quote_argument(arg));
+  std::vector<const char*> argv;
+  for (const auto& arg : quoted) argv.push_back(arg.c_str());
+  argv.push_back(nullptr);
+
+  int fds[2];
+  if (_pipe(fds, 4096, _O_TEXT | _O_NOINHERIT) != 0) return false;
+  // The child inherits the standard output, so redirect it while spawning
+  std::fflush(stdout);
+  const int saved_stdout = _dup(_fileno(stdout));
+  _dup2(fds[1], _fileno(stdout));
+  const intptr_t process = _spawnv(_P_NOWAIT, self.c_str(), argv.data());
+  _dup2(saved_stdout, _fileno(stdout));
+  _close(saved_stdout);
+  _close(fds[1]);
+  if (process == -1) {
+    _close(fds[0]);
+    return false;
+  }
+  FILE* output = _fdopen(fds[0], "r");
+  if (output == nullptr) {
+    _close(fds[0]);
+  } else {
+    read_samples(output, samples);
+    std::fclose(output);
+  }
+  int status = 0;
+  return _cwait(&status, process, _WAIT_CHILD) != -1 && status == 0 &&
+         output != nullptr;
+#else
+  std::vector<char*> argv;
+  for (auto& arg : args) argv.push_back(arg.data());
+  argv.push_back(nullptr);
+
+  int fds[2];
+  if (pipe(fds) != 0) return false;
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+  posix_spawn_file_actions_addclose(&actions, fds[0]);
+  posix_spawn_file_actions_addclose(&actions, fds[1]);
+  pid_t pid = 0;
+  const int error = posix_spawn(&pid, self.c_str(), &actions, nullptr,
+                                argv.data(), environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(fds[1]);
+  if (error != 0) {
+    close(fds[0]);
+    return false;
+  }
+  FILE* output = fdopen(fds[0], "r");
+  if (output == nullptr) {
+    close(fds[0]);
+  } else {
+    read_samples(output, samples);
+    std::fclose(output);
+  }
+  int status = 0;
+  return waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+         WEXITSTATUS(status) == 0 && output != nullptr;
+#endif
+}
+
+std::string escape(const std::string& value) {
+  std::string result;
+  for (const char c : value) {
+    if (c == '"' || c == '\\') result += '\\';
+    result += c;
+  }
+  return result;
+}
+
+std::string make_summary(const sycl::device& device, samples_t& samples,
+                         int repetitions) {
+  const auto platform = device.get_platform();
+
+  std::ostringstream out;
+  out << "{\"platform-name\": \""
+      << escape(platform.get_info<sycl::info::platform::name>())
+      << "\", \"platform-version\": \""
+      << escape(platform.get_info<sycl::info::platform::version>())
+      << "\", \"device-name\": \""
+      << escape(device.get_info<sycl::info::device::name>())
+      << "\", \"device-driver-version\": \""
+      << escape(device.get_info<sycl::info::device::driver_version>())
+      << "\", \"repetitions\": " << repetitions << ", \"phases-us\": {";
+  bool first = true;
+  for (auto& [name, values] : samples) {
+    std::sort(values.begin(), values.end());
+    out << (first ? "" : ", ") << "\"" << name << "\": {\"min\": "
+        << values.front() << ", \"median\": " << values[values.size() / 2]
+        << ", \"max\": " << values.back() << "}";
+    first = false;
+  }
+  out << "}}";
+  return out.str();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int repetitions = 20;
+  bool child = false;
+  std::string device_regex;
+  std::string output_file;
+  std::string history_file;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--child") {
+      child = true;
+    } else if (arg == "--device" && i + 1 < argc) {
+      device_regex = argv[++i];
+    } else if (arg == "--repetitions" && i + 1 < argc) {
+      repetitions = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--output" && i + 1 < argc) {
+      output_file = argv[++i];
+    } else if (arg == "--history" && i + 1 < argc) {
+      history_file = argv[++i];
+    } else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--device <regex>] [--repetitions <count>]"
+                   " [--output <file>] [--history <file>]\n";
+      return EXIT_FAILURE;
+    }
+  }
+  if (child) return run_phases(device_regex);
+
+  const std::string self = get_executable_path(argv[0]);
+  samples_t samples;
+  for (int i = 0; i < repetitions; ++i) {
+    if (!run_child(self, device_regex, samples)) {
+      std::cerr << "Repetition " << i << " failed\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The children have already checked that a device matches
+  const auto device =
+      select_device(sycl::device::get_devices(), device_regex).value();
+  const std::string summary = make_summary(device, samples, repetitions);
+  if (output_file.empty()) {
+    std::cout << summary << std::endl;
+  } else {
+    std::ofstream(output_file) << summary << std::endl;
+  }
+  if (!history_file.empty()) {
+    std::ofstream(history_file, std::ios::app) << summary << std::endl;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,226 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the latency of USM malloc_*, aligned_alloc_* and
+//  free for device, host and shared allocations:
+//   - single allocation and release across sizes from 1 B up to 1 GiB and
+//     alignments up to 2 MiB
+//   - concurrent allocation and release from several host threads
+//   - fragmentation workload with a random mix of allocations and releases
+//
+*******************************************************************************/
+
+#include "benchmark_common.h"
+
+#include "../../util/usm_helper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark_usm_allocation_latency {
+using namespace sycl_cts;
+
+constexpr size_t KiB = 1024;
+constexpr size_t MiB = 1024 * KiB;
+constexpr size_t GiB = 1024 * MiB;
+
+/** @brief Provides the allocation sizes the device is able to serve
+ */
+std::vector<size_t> get_sizes(const sycl::device& device) {
+  const size_t max_alloc =
+      device.get_info<sycl::info::device::max_mem_alloc_size>();
+  // Leave room for the runtime and the other allocations of the process
+  const size_t max_size = std::min<size_t>(
+      max_alloc, device.get_info<sycl::info::device::global_mem_size>() / 4);
+
+  std::vector<size_t> result;
+  for (const size_t size : {size_t{1}, size_t{64}, 4 * KiB, 64 * KiB, 1 * MiB,
+                            16 * MiB, 256 * MiB, 1 * GiB}) {
+    if (size <= max_size) result.push_back(size);
+  }
+  return result;
+}
+
+constexpr size_t alignments[] = {64, 4 * KiB, 64 * KiB, 2 * MiB};
+
+std::string to_string(size_t bytes) {
+  if (bytes >= GiB && bytes % GiB == 0) {
+    return std::to_string(bytes / GiB) + " GiB";
+  }
+  if (bytes >= MiB && bytes % MiB == 0) {
+    return std::to_string(bytes / MiB) + " MiB";
+  }
+  if (bytes >= KiB && bytes % KiB == 0) {
+    return std::to_string(bytes / KiB) + " KiB";
+  }
+  return std::to_string(bytes) + " B";
+}
+
+template <sycl::usm::alloc Kind>
+void* allocate(sycl::queue& queue, size_t bytes, size_t alignment = 0) {
+  void* ptr = alignment == 0
+                  ? sycl::malloc(bytes, queue, Kind)
+                  : sycl::aligned_alloc(alignment, bytes, queue, Kind);
+  if (ptr == nullptr) {
+    throw std::runtime_error("USM allocation of " + to_string(bytes) +
+                             " failed");
+  }
+  return ptr;
+}
+
+/** @brief Releases USM allocations owned by std::unique_ptr
+ */
+struct usm_deleter {
+  sycl::queue queue;
+  void operator()(void* ptr) const { sycl::free(ptr, queue); }
+};
+
+using usm_ptr = std::unique_ptr<void, usm_deleter>;
+
+template <sycl::usm::alloc Kind>
+void run_single_thread(sycl::queue& queue) {
+  const std::string kind{usm_helper::get_allocation_description<Kind>()};
+
+  for (const size_t size : get_sizes(queue.get_device())) {
+    BENCHMARK("malloc_" + kind + " + free " + to_string(size)) {
+      sycl::free(allocate<Kind>(queue, size), queue);
+    };
+
+    for (const size_t alignment : alignments) {
+      {
+        // Verify alignment once outside of the measured loop
+        void* ptr = allocate<Kind>(queue, size, alignment);
+        INFO("aligned_alloc_" << kind << " of " << to_string(size)
+                              << " with alignment " << to_string(alignment));
+        CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0);
+        sycl::free(ptr, queue);
+      }
+      BENCHMARK("aligned_alloc_" + kind + " + free " + to_string(size) +
+                ", alignment " + to_string(alignment)) {
+        sycl::free(allocate<Kind>(queue, size, alignment), queue);
+      };
+    }
+  }
+}
+
+/** @brief Allocates and releases from several host threads at once and reports
+ *         the average latency of an allocation and release pair
+ */
+template <sycl::usm::alloc Kind>
+void run_multi_thread(sycl::queue& queue) {
+  const std::string kind{usm_helper::get_allocation_description<Kind>()};
+  const size_t thread_count =
+      std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 16);
+  constexpr size_t pairs_per_thread = 1000;
+
+  for (const size_t size : {size_t{64}, 4 * KiB, 1 * MiB}) {
+    std::atomic<size_t> failures{0};
+    const double duration_ns = benchmark_common::measure_ns([&] {
+      std::vector<std::thread> threads;
+      for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+          for (size_t i = 0; i < pairs_per_thread; ++i) {
+            void* ptr = sycl::malloc(size, queue, Kind);
+            if (ptr == nullptr) {
+              ++failures;
+              continue;
+            }
+            sycl::free(ptr, queue);
+          }
+        });
+      }
+      for (auto& thread : threads) thread.join();
+    });
+    CHECK(failures == 0);
+
+    benchmark_common::report(
+        "malloc_" + kind + " + free " + to_string(size) + " from " +
+            std::to_string(thread_count) + " threads",
+        duration_ns / (thread_count * pairs_per_thread), "ns per pair");
+  }
+}
+
+/** @brief Keeps a pool of live allocations and randomly allocates or releases
+ *         blocks of random size, so that the allocator has to deal with
+ *         fragmented memory
+ */
+template <sycl::usm::alloc Kind>
+void run_fragmentation(sycl::queue& queue) {
+  const std::string kind{usm_helper::get_allocation_description<Kind>()};
+  constexpr size_t slot_count = 1024;
+  constexpr size_t operation_count = 20000;
+
+  std::mt19937 generator(42);
+  // Sizes are distributed logarithmically between 16 B and 1 MiB
+  std::uniform_int_distribution<int> size_log(4, 20);
+  std::uniform_int_distribution<size_t> slot(0, slot_count - 1);
+
+  // Owning slots release whatever is left, also if an allocation throws
+  std::vector<usm_ptr> slots;
+  slots.reserve(slot_count);
+  for (size_t i = 0; i < slot_count; ++i) {
+    slots.emplace_back(nullptr, usm_deleter{queue});
+  }
+  size_t allocations = 0;
+  const double duration_ns = benchmark_common::measure_ns([&] {
+    for (size_t i = 0; i < operation_count; ++i) {
+      usm_ptr& ptr = slots[slot(generator)];
+      if (ptr) {
+        ptr.reset();
+      } else {
+        const size_t size = (size_t{1} << size_log(generator)) +
+                            std::uniform_int_distribution<size_t>(0, 15)(
+                                generator);
+        ptr.reset(allocate<Kind>(queue, size));
+        ++allocations;
+      }
+    }
+  });
+  slots.clear();
+
+  benchmark_common::report("fragmentation workload for " + kind + " USM",
+                           duration_ns / operation_count,
+                           "ns per operation");
+  benchmark_common::report("fragmentation workload for " + kind + " USM",
+                           static_cast<double>(allocations), "allocations");
+}
+
+TEMPLATE_TEST_CASE_SIG("USM allocation and release latency",
+                       "[benchmark][usm]", ((sycl::usm::alloc Kind), Kind),
+                       sycl::usm::alloc::device, sycl::usm::alloc::host,
+                       sycl::usm::alloc::shared) {
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(usm_helper::get_aspect<Kind>())) {
+    SKIP("Device does not support "
+         << usm_helper::get_allocation_description<Kind>()
+         << " USM allocations");
+  }
+
+  SECTION("single thread") { run_single_thread<Kind>(queue); }
+  SECTION("multiple threads") { run_multi_thread<Kind>(queue); }
+  SECTION("fragmentation") { run_fragmentation<Kind>(queue); }
+}
+
+}  // namespace benchmark_usm_allocation_latency
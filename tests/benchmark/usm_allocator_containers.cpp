@@ -0,0 +1,161 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for standard containers backed by sycl::usm_allocator
+//  with host and shared allocations, compared with std::allocator:
+//   - std::vector growth by push_back, with and without reserve
+//   - std::unordered_map node insertion and erasure
+//   - many small allocations through the allocator directly
+//
+*******************************************************************************/
+
+#include "benchmark_common.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace benchmark_usm_allocator_containers {
+using namespace sycl_cts;
+
+enum class allocator_kind { standard, usm_host, usm_shared };
+
+template <allocator_kind Kind>
+std::string get_name() {
+  if constexpr (Kind == allocator_kind::standard) {
+    return "std::allocator";
+  } else if constexpr (Kind == allocator_kind::usm_host) {
+    return "usm_allocator<host>";
+  } else {
+    return "usm_allocator<shared>";
+  }
+}
+
+/** @brief Provides the allocator of the kind given for elements of type T
+ */
+template <allocator_kind Kind, typename T>
+auto make_allocator(const sycl::queue& queue) {
+  if constexpr (Kind == allocator_kind::standard) {
+    return std::allocator<T>{};
+  } else if constexpr (Kind == allocator_kind::usm_host) {
+    return sycl::usm_allocator<T, sycl::usm::alloc::host>{queue};
+  } else {
+    return sycl::usm_allocator<T, sycl::usm::alloc::shared>{queue};
+  }
+}
+
+template <allocator_kind Kind>
+bool is_supported(const sycl::device& device) {
+  if constexpr (Kind == allocator_kind::usm_host) {
+    return device.has(sycl::aspect::usm_host_allocations);
+  } else if constexpr (Kind == allocator_kind::usm_shared) {
+    return device.has(sycl::aspect::usm_shared_allocations);
+  } else {
+    return true;
+  }
+}
+
+template <allocator_kind Kind>
+void run_vector_growth(const sycl::queue& queue) {
+  using allocator_t = decltype(make_allocator<Kind, int>(queue));
+  const std::string name = get_name<Kind>();
+
+  for (const size_t count : {size_t{1'000}, size_t{1'000'000}}) {
+    {
+      std::vector<int, allocator_t> values(make_allocator<Kind, int>(queue));
+      for (size_t i = 0; i < count; ++i) values.push_back(static_cast<int>(i));
+      CHECK(values.size() == count);
+      CHECK(values[count - 1] == static_cast<int>(count - 1));
+    }
+    BENCHMARK("std::vector push_back x" + std::to_string(count) + ", " +
+              name) {
+      std::vector<int, allocator_t> values(make_allocator<Kind, int>(queue));
+      for (size_t i = 0; i < count; ++i) values.push_back(static_cast<int>(i));
+      return values.size();
+    };
+    BENCHMARK("std::vector reserve + push_back x" + std::to_string(count) +
+              ", " + name) {
+      std::vector<int, allocator_t> values(make_allocator<Kind, int>(queue));
+      values.reserve(count);
+      for (size_t i = 0; i < count; ++i) values.push_back(static_cast<int>(i));
+      return values.size();
+    };
+  }
+}
+
+template <allocator_kind Kind>
+void run_map_churn(const sycl::queue& queue) {
+  using value_t = std::pair<const int, int>;
+  using allocator_t = decltype(make_allocator<Kind, value_t>(queue));
+  using map_t =
+      std::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                         allocator_t>;
+  const std::string name = get_name<Kind>();
+  constexpr int live_nodes = 1'000;
+  constexpr int operations = 10'000;
+
+  BENCHMARK("std::unordered_map insert + erase x" +
+            std::to_string(operations) + ", " + name) {
+    map_t map(live_nodes, std::hash<int>{}, std::equal_to<int>{},
+              make_allocator<Kind, value_t>(queue));
+    // Keep a window of live nodes, so that every insertion allocates a node
+    // and every erasure releases one
+    for (int i = 0; i < operations; ++i) {
+      map.emplace(i, i);
+      if (i >= live_nodes) map.erase(i - live_nodes);
+    }
+    return map.size();
+  };
+}
+
+/** @brief Measures per-allocation overhead for many small allocations that
+ *         are all alive at the same time
+ */
+template <allocator_kind Kind>
+void run_small_allocations(const sycl::queue& queue) {
+  const std::string name = get_name<Kind>();
+  constexpr size_t count = 10'000;
+  auto allocator = make_allocator<Kind, int>(queue);
+  std::vector<int*> pointers(count, nullptr);
+
+  const double duration_ns = benchmark_common::measure_ns([&] {
+    for (auto& ptr : pointers) ptr = allocator.allocate(1);
+    for (auto& ptr : pointers) allocator.deallocate(ptr, 1);
+  });
+  benchmark_common::report(
+      std::to_string(count) + " live allocations of one int, " + name,
+      duration_ns / count, "ns per allocate + deallocate");
+}
+
+TEMPLATE_TEST_CASE_SIG("Containers with usm_allocator vs. std::allocator",
+                       "[benchmark][usm]", ((allocator_kind Kind), Kind),
+                       allocator_kind::standard, allocator_kind::usm_host,
+                       allocator_kind::usm_shared) {
+  auto queue = once_per_unit::get_queue();
+  if (!is_supported<Kind>(queue.get_device())) {
+    SKIP("Device does not support USM allocations for " << get_name<Kind>());
+  }
+
+  SECTION("vector growth") { run_vector_growth<Kind>(queue); }
+  SECTION("unordered_map node churn") { run_map_churn<Kind>(queue); }
+  SECTION("small allocations") { run_small_allocations<Kind>(queue); }
+}
+
+}  // namespace benchmark_usm_allocator_containers
@@ -0,0 +1,227 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides benchmarks for the migration of shared USM allocations between
+//  host and device:
+//   - device first-touch latency of host-resident data without hints, after
+//     prefetch and after mem_advise
+//   - host first-touch latency of device-resident data
+//   - host/device ping-pong throughput
+//  Each access densely touches one cacheline, one page or the whole
+//  allocation.
+//
+*******************************************************************************/
+
+#include "benchmark_common.h"
+
+#include "../../util/usm_helper.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Advice values for mem_advise are implementation-defined, with 0 being the
+// default behavior. Implementation-specific values to measure can be provided
+// as a comma-separated list, e.g.
+// -DSYCL_CTS_BENCHMARK_MEM_ADVICE_VALUES=0,1,2
+#ifndef SYCL_CTS_BENCHMARK_MEM_ADVICE_VALUES
+#define SYCL_CTS_BENCHMARK_MEM_ADVICE_VALUES 0
+#endif
+
+namespace benchmark_usm_shared_migration {
+using namespace sycl_cts;
+
+using elem_t = unsigned int;
+
+constexpr int advice_values[] = {SYCL_CTS_BENCHMARK_MEM_ADVICE_VALUES};
+constexpr size_t buffer_bytes = 64 * 1024 * 1024;
+constexpr int repetitions = 5;
+
+struct granularity {
+  const char* name;
+  // Number of bytes touched at the start of the allocation, or zero for the
+  // whole allocation
+  size_t bytes;
+
+  size_t elements(size_t count) const {
+    return bytes == 0 ? count : std::min(count, bytes / sizeof(elem_t));
+  }
+};
+
+constexpr granularity granularities[] = {
+    {"cacheline", 64}, {"page", 4096}, {"whole buffer", 0}};
+
+void host_touch(elem_t* data, size_t count) {
+  for (size_t i = 0; i < count; ++i) data[i] += 1;
+}
+
+void device_touch(sycl::queue& queue, elem_t* data, size_t count) {
+  queue
+      .parallel_for(sycl::range<1>{count},
+                    [=](sycl::id<1> i) { data[i[0]] += 1; })
+      .wait_and_throw();
+}
+
+/** @brief Restores the default behavior after mem_advise, so that the advice
+ *         does not affect later measurements
+ */
+void reset_mem_advice(sycl::queue& queue, elem_t* data, size_t bytes) {
+  queue.mem_advise(data, bytes, 0).wait_and_throw();
+}
+
+/** @brief Provides the median duration of the action given, with the setup
+ *         given executed before and the teardown given executed after each
+ *         measurement
+ */
+template <typename SetupT, typename ActionT,
+          typename TeardownT = benchmark_common::no_op>
+double median_ns(SetupT&& setup, ActionT&& action, TeardownT&& teardown = {}) {
+  std::vector<double> durations;
+  for (int i = 0; i < repetitions; ++i) {
+    setup();
+    durations.push_back(benchmark_common::measure_ns(action));
+    teardown();
+  }
+  std::nth_element(durations.begin(), durations.begin() + repetitions / 2,
+                   durations.end());
+  return durations[repetitions / 2];
+}
+
+void run_device_first_touch(sycl::queue& queue, elem_t* data, size_t count) {
+  const size_t bytes = count * sizeof(elem_t);
+  // Make the whole allocation resident on host before each measurement
+  auto on_host = [&] { host_touch(data, count); };
+  auto reset_advice = [&] { reset_mem_advice(queue, data, bytes); };
+
+  for (const auto& g : granularities) {
+    const std::string suffix = std::string(", ") + g.name;
+    const size_t touched = g.elements(count);
+
+    benchmark_common::report(
+        "device first touch without hints" + suffix,
+        median_ns(on_host, [&] { device_touch(queue, data, touched); }),
+        "ns");
+
+    double kernel_ns = 0;
+    const double total_ns = median_ns(on_host, [&] {
+      queue.prefetch(data, bytes).wait_and_throw();
+      kernel_ns = benchmark_common::measure_ns(
+          [&] { device_touch(queue, data, touched); });
+    });
+    benchmark_common::report("device first touch after prefetch" + suffix,
+                             total_ns, "ns including prefetch");
+    benchmark_common::report("device first touch after prefetch" + suffix,
+                             kernel_ns, "ns kernel only, last repetition");
+
+    for (const int advice : advice_values) {
+      benchmark_common::report(
+          "device first touch after mem_advise(" + std::to_string(advice) +
+              ")" + suffix,
+          median_ns(on_host,
+                    [&] {
+                      queue.mem_advise(data, bytes, advice).wait_and_throw();
+                      device_touch(queue, data, touched);
+                    },
+                    reset_advice),
+          "ns including mem_advise");
+    }
+  }
+}
+
+void run_host_first_touch(sycl::queue& queue, elem_t* data, size_t count) {
+  const size_t bytes = count * sizeof(elem_t);
+  // Make the whole allocation resident on device before each measurement
+  auto on_device = [&] { device_touch(queue, data, count); };
+  auto reset_advice = [&] { reset_mem_advice(queue, data, bytes); };
+
+  for (const auto& g : granularities) {
+    const std::string suffix = std::string(", ") + g.name;
+    const size_t touched = g.elements(count);
+    benchmark_common::report(
+        "host first touch without hints" + suffix,
+        median_ns(on_device, [&] { host_touch(data, touched); }),
+        "ns");
+
+    for (const int advice : advice_values) {
+      benchmark_common::report(
+          "host first touch after mem_advise(" + std::to_string(advice) + ")" +
+              suffix,
+          median_ns(
+              [&] {
+                on_device();
+                queue.mem_advise(data, bytes, advice).wait_and_throw();
+              },
+              [&] { host_touch(data, touched); }, reset_advice),
+          "ns");
+    }
+  }
+}
+
+void run_ping_pong(sycl::queue& queue, elem_t* data, size_t count) {
+  constexpr int iterations = 20;
+  for (const auto& g : granularities) {
+    const size_t touched = g.elements(count);
+    const double bytes = static_cast<double>(touched * sizeof(elem_t));
+    std::fill(data, data + count, elem_t{0});
+    const double duration_ns = benchmark_common::measure_ns([&] {
+      for (int i = 0; i < iterations; ++i) {
+        host_touch(data, touched);
+        device_touch(queue, data, touched);
+      }
+    });
+    {
+      INFO("ping-pong with granularity of " << g.name);
+      CHECK(data[0] == 2 * iterations);
+      CHECK(data[touched - 1] == 2 * iterations);
+      if (touched < count) CHECK(data[touched] == 0);
+    }
+
+    const std::string name = std::string("host/device ping-pong, ") + g.name;
+    benchmark_common::report(name, duration_ns / (2 * iterations),
+                             "ns per access round");
+    // Every round trip migrates at least the touched bytes twice
+    benchmark_common::report(name, 2 * iterations * bytes / duration_ns,
+                             "GB/s of touched data migrated");
+  }
+}
+
+TEST_CASE("Shared USM migration, prefetch and mem_advise",
+          "[benchmark][usm]") {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  if (!device.has(sycl::aspect::usm_shared_allocations)) {
+    SKIP("Device does not support shared USM allocations");
+  }
+
+  const size_t count =
+      std::min<size_t>(
+          buffer_bytes,
+          device.get_info<sycl::info::device::max_mem_alloc_size>() / 4) /
+      sizeof(elem_t);
+  auto allocation =
+      usm_helper::allocate_usm_memory<sycl::usm::alloc::shared, elem_t>(queue,
+                                                                        count);
+  elem_t* data = allocation.get();
+  REQUIRE(data != nullptr);
+
+  SECTION("device first touch") { run_device_first_touch(queue, data, count); }
+  SECTION("host first touch") { run_host_first_touch(queue, data, count); }
+  SECTION("ping-pong") { run_ping_pong(queue, data, count); }
+}
+
+}  // namespace benchmark_usm_shared_migration
@@ -87,6 +87,6 @@ public:
 };
 
 // construction of this proxy will register the above test
-util::test_proxy<TEST_NAME> proxy;
+util::test_proxy<TEST_NAME> proxy{TOSTRING(TEST_NAME)};
 
 } /* namespace TEST_NAMESPACE */
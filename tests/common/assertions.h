@@ -15,7 +15,12 @@
 
 #include "../../util/logger.h"
 #include "../common/macros.h"
+
+#include <catch2/catch_tostring.hpp>
+
+#include <cstddef>
 #include <string>
+#include <utility>
 
 /** @brief Interface for any test case description class to use for logs within
  *         generic assertions
@@ -86,4 +91,110 @@ void expect_throws(sycl_cts::util::logger &log,
   }
 }
 
+namespace sycl_cts::assertions {
+
+/** @brief Number of mismatches reported in details by CHECK_ALL and friends
+ */
+inline constexpr std::size_t max_reported_mismatches = 8;
+
+/** @brief Outcome of a predicate evaluated over a range of indices
+ */
+struct range_check_result {
+  std::size_t count = 0;
+  std::size_t mismatch_count = 0;
+  std::string details;
+
+  std::string to_string() const {
+    if (mismatch_count == 0) {
+      return "All " + std::to_string(count) + " elements match";
+    }
+    std::string result = std::to_string(mismatch_count) + " of " +
+                         std::to_string(count) + " elements mismatch";
+    if (mismatch_count > max_reported_mismatches) {
+      result += ", first " + std::to_string(max_reported_mismatches) + " are";
+    }
+    return result + ":" + details;
+  }
+};
+
+/** @brief Evaluate predicate for each index within [0, count)
+ *  @details Only mismatching indices pay for the message construction, and
+ *           only for the first max_reported_mismatches of them.
+ *  @param describe Functor providing details for the mismatching index given
+ */
+template <typename PredicateT, typename DescribeT>
+range_check_result check_all(std::size_t count, PredicateT&& predicate,
+                             DescribeT&& describe) {
+  range_check_result result;
+  result.count = count;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (predicate(i)) continue;
+    if (result.mismatch_count < max_reported_mismatches) {
+      result.details += "\n  [" + std::to_string(i) + "] " + describe(i);
+    }
+    ++result.mismatch_count;
+  }
+  return result;
+}
+
+template <typename PredicateT>
+range_check_result check_all(std::size_t count, PredicateT&& predicate) {
+  return check_all(count, std::forward<PredicateT>(predicate),
+                   [](std::size_t) { return std::string("failed"); });
+}
+
+/** @brief Compare the first count elements of two indexable ranges
+ *  @details Any type with operator[] can be used, for example std::vector,
+ *           pointer or host accessor.
+ */
+template <typename ActualT, typename ExpectedT, typename ComparatorT>
+range_check_result check_all_equal(std::size_t count, const ActualT& actual,
+                                   const ExpectedT& expected,
+                                   ComparatorT&& comparator) {
+  return check_all(
+      count, [&](std::size_t i) { return comparator(actual[i], expected[i]); },
+      [&](std::size_t i) {
+        return "result: " + Catch::Detail::stringify(actual[i]) +
+               ", expected: " + Catch::Detail::stringify(expected[i]);
+      });
+}
+
+template <typename ActualT, typename ExpectedT>
+range_check_result check_all_equal(std::size_t count, const ActualT& actual,
+                                   const ExpectedT& expected) {
+  return check_all_equal(
+      count, actual, expected,
+      [](const auto& lhs, const auto& rhs) { return lhs == rhs; });
+}
+
+}  // namespace sycl_cts::assertions
+
+#define INTERNAL_CTS_CHECK_RANGE(CATCH_MACRO, ...)                    \
+  do {                                                               \
+    const auto cts_range_result = __VA_ARGS__;                       \
+    INFO(cts_range_result.to_string());                              \
+    CATCH_MACRO(cts_range_result.mismatch_count == 0);               \
+  } while (false)
+
+/** @brief Range assertions counted as a single Catch2 assertion
+ *  @details Intended for bulk verification of results on host instead of
+ *           calling CHECK for each element. Arguments are forwarded to
+ *           sycl_cts::assertions::check_all and check_all_equal, so lambdas
+ *           with commas can be passed without additional parentheses:
+ *             CHECK_ALL(size, [&](size_t i) { return res[i] == i; });
+ *             CHECK_ALL_EQUAL(size, res, expected);
+ *             CHECK_ALL_EQUAL(size, res, expected, comparator);
+ */
+#define CHECK_ALL(...) \
+  INTERNAL_CTS_CHECK_RANGE(CHECK, ::sycl_cts::assertions::check_all(__VA_ARGS__))
+#define REQUIRE_ALL(...)           \
+  INTERNAL_CTS_CHECK_RANGE(REQUIRE, \
+                           ::sycl_cts::assertions::check_all(__VA_ARGS__))
+#define CHECK_ALL_EQUAL(...)      \
+  INTERNAL_CTS_CHECK_RANGE(CHECK, \
+                           ::sycl_cts::assertions::check_all_equal(__VA_ARGS__))
+#define REQUIRE_ALL_EQUAL(...)      \
+  INTERNAL_CTS_CHECK_RANGE(REQUIRE, \
+                           ::sycl_cts::assertions::check_all_equal(__VA_ARGS__))
+
 #endif  // __SYCLCTS_TESTS_COMMON_ASSERTIONS_H
@@ -11,6 +11,7 @@
 #define __SYCLCTS_TESTS_COMMON_ASYNC_WORK_GROUP_COPY_H
 
 #include "../common/common.h"
+#include "../common/memory_tracking.h"
 #include "../common/once_per_unit.h"
 #include "../common/type_coverage.h"
 #include "../../util/array.h"
@@ -301,10 +302,10 @@ void test_async_wg_copy(sycl::queue &queue, sycl_cts::util::logger &log,
                                                     RANGE_SIZE_2D);
   {
     const size_t globalBufferSize = workGroupRange.size() * BUFFER_SIZE;
-    auto buf = sycl::buffer<T, 1>(sycl::range<1>(globalBufferSize));
-    auto resultBuffer =
-        sycl::buffer<bool, 1>(result.data(),
-                                  sycl::range<1>(result.size()));
+    auto buf =
+        memory_tracking::make_buffer<T>(sycl::range<1>(globalBufferSize));
+    auto resultBuffer = memory_tracking::make_write_back_buffer(
+        result.data(), sycl::range<1>(result.size()));
 
     queue.submit([&](sycl::handler &cgh) {
     auto accResult =
@@ -409,9 +410,10 @@ void test_wait_for(sycl::queue &queue, sycl_cts::util::logger &log,
                                                     RANGE_SIZE_2D);
   {
     const size_t globalBufferSize = workGroupRange.size() * BUFFER_SIZE;
-    auto buf = sycl::buffer<T, 1>(sycl::range<1>(globalBufferSize));
+    auto buf =
+        memory_tracking::make_buffer<T>(sycl::range<1>(globalBufferSize));
     auto resultBuffer =
-        sycl::buffer<bool, 1>(&result, sycl::range<1>(1));
+        memory_tracking::make_write_back_buffer(&result, sycl::range<1>(1));
 
     queue.submit([&](sycl::handler &cgh) {
     auto accResult =
@@ -622,8 +622,22 @@ def substitute_swizzles_templates(type_str, size, index_subset, value_subset, co
         test_string)
     return string
 
-def gen_swizzle_test(type_str, convert_type_str, as_type_str, size, num_batches, batch_index):
-    string = ''
+def distribute_swizzles_to_batches(type_str, size, swizzle_list_dict,
+                                   convert_type_str, as_type_str, num_batches,
+                                   batches):
+    swizzle_combinations = list(zip(
+        product(swizzle_list_dict[size][:size], repeat=size),
+        product(Data.vals_list_dict[size][:size], repeat=size)))
+    batch_size = ceil(len(swizzle_combinations) / num_batches)
+    for cur_index, (index_subset, value_subset) in enumerate(
+            swizzle_combinations):
+        cur_batch = floor(cur_index / batch_size)
+        if cur_batch in batches:
+            batches[cur_batch] += substitute_swizzles_templates(type_str, size,
+                    index_subset, value_subset, convert_type_str, as_type_str)
+
+def gen_swizzle_test(type_str, convert_type_str, as_type_str, size, num_batches,
+                     batch_indices):
     if size > 4:
         test_string = SwizzleData.swizzle_full_test_template.substitute(
             name=Data.vec_name_dict[size],
@@ -645,7 +659,7 @@ def gen_swizzle_test(type_str, convert_type_str, as_type_str, size, num_batches,
                 swap_pairs(Data.vals_list_dict[size])),
             reverse_order_pair_vals=', '.join(
                 swap_pairs(Data.vals_list_dict[size][::-1])))
-        string += wrap_with_swizzle_kernel(
+        string = wrap_with_swizzle_kernel(
                 type_str, str(size), ', '.join(Data.vals_list_dict[size]),
                 ', '.join(Data.vals_list_dict[size][::-1]),
                 ', '.join(swap_pairs(Data.vals_list_dict[size])),
@@ -656,70 +670,28 @@ def gen_swizzle_test(type_str, convert_type_str, as_type_str, size, num_batches,
             'vec<' + type_str + ', ' + str(size) + '> .swizzle<' +
             ', '.join(Data.swizzle_elem_list_dict[size][:size]) + '>',
             test_string)
-        return string
-   
-    # Case when size <=4
-    # The test files generated for swizzles of vectors of size <= 4 are enormous and are hurting 
-    # compilation times of the suite so we batch the tests according to two command line arguments 
-    # in num_batches and batch_index that will dictate how many tests we can put in a single test file. 
-    # Specifically, the test cases are to be split in num_batches different groups aka batches 
-    # and the batch_index tells the script which batch in particular we want to output to a test file during this run. 
-    # Both of these arguments, num_batches and batch_index, are controlled by the cmake test generation script.
-    
-    total_tests = 0
-    for length in range(size, size + 1):
-        for index_subset, value_subset in zip(
-                product(
-                    Data.swizzle_xyzw_list_dict[size][:size],
-                    repeat=length),
-                product(Data.vals_list_dict[size][:size], repeat=length)):
-            total_tests += 1
-    batch_size = ceil(total_tests / num_batches)
-    cur_index = 0
-    cur_batch = 0
-    for length in range(size, size + 1):
-        for index_subset, value_subset in zip(
-                product(
-                    Data.swizzle_xyzw_list_dict[size][:size],
-                    repeat=length),
-                product(Data.vals_list_dict[size][:size], repeat=length)):
-            cur_batch = floor(cur_index / batch_size)
-            if cur_batch > batch_index:
-                break
-            if cur_batch == batch_index:
-                string += substitute_swizzles_templates(type_str, size,
-                        index_subset, value_subset, convert_type_str, as_type_str)
-            cur_index += 1
+        # The full swizzle test is not split and is part of every batch
+        return {batch_index: string for batch_index in batch_indices}
 
+    # Case when size <=4
+    # The test files generated for swizzles of vectors of size <= 4 are enormous and are hurting
+    # compilation times of the suite so we batch the tests according to two command line arguments
+    # in num_batches and batch_indices that will dictate how many tests we can put in a single test file.
+    # Specifically, the test cases are to be split in num_batches different groups aka batches
+    # and batch_indices tells the script which batches in particular we want to output during this run.
+    # The swizzles are enumerated only once, regardless of the number of requested batches.
+    # Both of these arguments, num_batches and batch_indices, are controlled by the cmake test generation script.
+    batches = {batch_index: '' for batch_index in batch_indices}
+    distribute_swizzles_to_batches(type_str, size, Data.swizzle_xyzw_list_dict,
+                                   convert_type_str, as_type_str, num_batches,
+                                   batches)
     # Same logic as above repeated for the case when size == 4
     if size == 4:
-        total_tests = 0
-        for length in range(size, size + 1):
-            for index_subset, value_subset in zip(
-                    product(
-                        Data.swizzle_rgba_list_dict[size][:size],
-                        repeat=length),
-                    product(
-                        Data.vals_list_dict[size][:size], repeat=length)):
-                total_tests += 1
-        batch_size = ceil(total_tests / num_batches)
-        cur_index = 0
-        cur_batch = 0
-        for length in range(size, size + 1):
-            for index_subset, value_subset in zip(
-                    product(
-                        Data.swizzle_rgba_list_dict[size][:size],
-                        repeat=length),
-                    product(
-                        Data.vals_list_dict[size][:size], repeat=length)):
-                cur_batch = floor(cur_index / batch_size)
-                if cur_batch > batch_index:
-                    break
-                if cur_batch == batch_index:
-                    string += substitute_swizzles_templates(type_str, size,
-                            index_subset, value_subset, convert_type_str, as_type_str)
-                cur_index += 1
-    return string
+        distribute_swizzles_to_batches(type_str, size,
+                                       Data.swizzle_rgba_list_dict,
+                                       convert_type_str, as_type_str,
+                                       num_batches, batches)
+    return batches
 
 
 def write_swizzle_source_file(swizzles, input_file, output_file, type_str):
@@ -769,24 +741,18 @@ def get_reverse_type(type_str):
 # Reason for the TODO above is that this function and several more it calls are
 # not really common and only used to generate vector_swizzles test.
 # FIXME: The test (main template and others) should be updated to use Catch2
-def make_swizzles_tests(type_str, input_file, output_file, num_batches, batch_index):
+def make_swizzles_tests(type_str, input_file, output_files, num_batches,
+                        batch_indices):
     if type_str == 'bool':
         Data.vals_list_dict = cast_to_bool(Data.vals_list_dict)
 
-    swizzles = [None] * 6
-
     convert_type_str = get_reverse_type(type_str)
     as_type_str = get_reverse_type(type_str)
-    swizzles[0] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 1, num_batches, batch_index)
-    swizzles[1] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 2, num_batches, batch_index)
-    swizzles[2] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 3, num_batches, batch_index)
-    swizzles[3] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 4, num_batches, batch_index)
-    swizzles[4] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 8, num_batches, batch_index)
-    swizzles[5] = gen_swizzle_test(type_str, convert_type_str,
-                                   as_type_str, 16, num_batches, batch_index)
-    write_swizzle_source_file(swizzles, input_file, output_file, type_str)
+    swizzles_per_size = [
+        gen_swizzle_test(type_str, convert_type_str, as_type_str, size,
+                         num_batches, batch_indices)
+        for size in [1, 2, 3, 4, 8, 16]
+    ]
+    for batch_index, output_file in zip(batch_indices, output_files):
+        swizzles = [batches[batch_index] for batches in swizzles_per_size]
+        write_swizzle_source_file(swizzles, input_file, output_file, type_str)
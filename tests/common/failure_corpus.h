@@ -0,0 +1,233 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides recording of failing inputs of sweep-style checks to a corpus
+//  file and their replay.
+//
+//  With --failure-corpus <file>, checks append each failing input to the
+//  file given. With --replay <file>, only the test cases recorded in the
+//  corpus are run, and checks supporting the corpus execute only the
+//  recorded inputs instead of their whole input space.
+//
+//  The corpus is a compact binary file in host byte order: the magic string
+//  "SYCLCTSF" and a 32-bit version, followed by records of
+//   - test case name, check name, type names, check configuration and device
+//     name, each stored as a 32-bit length followed by the characters
+//   - 64-bit index the check generates its input from
+//   - input bytes, stored as a 32-bit length followed by the bytes
+//  The check configuration describes how the check maps indices to inputs,
+//  so that a check can reject entries recorded by a differently configured
+//  build.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_FAILURE_CORPUS_H
+#define __SYCLCTS_TESTS_COMMON_FAILURE_CORPUS_H
+
+#include "../../util/singleton.h"
+
+#include <catch2/interfaces/catch_interfaces_capture.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sycl_cts::failure_corpus {
+
+/** @brief A single failing input of a check
+ */
+struct entry {
+  std::string test_case;
+  std::string check;
+  std::string types;
+  std::string configuration;
+  std::string device;
+  uint64_t index = 0;
+  std::vector<unsigned char> input;
+
+  /** @brief Reinterprets the input bytes as values of T
+   */
+  template <typename T>
+  std::vector<T> input_as() const {
+    static_assert(std::is_trivially_copyable_v<T>);
+    std::vector<T> result(input.size() / sizeof(T));
+    if (!result.empty()) {
+      std::memcpy(result.data(), input.data(), result.size() * sizeof(T));
+    }
+    return result;
+  }
+};
+
+/** @brief Keeps the corpus file to record to and the corpus loaded for
+ *         replay
+ *  @details Recording is thread safe; each record is appended to the file
+ *           right away, so that the corpus survives a crash of the test
+ *           executable later on.
+ */
+class corpus : public util::singleton<corpus> {
+  static constexpr char magic[8] = {'S', 'Y', 'C', 'L', 'C', 'T', 'S', 'F'};
+  static constexpr uint32_t version = 2;
+
+ public:
+  void set_output(const std::string& path) { m_output = path; }
+
+  bool is_recording() const { return !m_output.empty(); }
+
+  /** @brief Appends the entry given to the output corpus file, if any
+   */
+  void record(const entry& e) {
+    if (!is_recording()) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::ofstream out(m_output,
+                      std::ios::binary | std::ios::app | std::ios::ate);
+    if (!out) {
+      throw std::runtime_error("Cannot open failure corpus " + m_output);
+    }
+    if (out.tellp() == 0) {
+      out.write(magic, sizeof(magic));
+      write_value(out, version);
+    }
+    write_string(out, e.test_case);
+    write_string(out, e.check);
+    write_string(out, e.types);
+    write_string(out, e.configuration);
+    write_string(out, e.device);
+    write_value(out, e.index);
+    write_value(out, static_cast<uint32_t>(e.input.size()));
+    out.write(reinterpret_cast<const char*>(e.input.data()), e.input.size());
+  }
+
+  /** @brief Records a failing input of the currently running test case
+   */
+  template <typename T>
+  void record(const std::string& check, const std::string& types,
+              const std::string& configuration, const std::string& device,
+              uint64_t index, const T& input) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (!is_recording()) return;
+    entry e{Catch::getResultCapture().getCurrentTestName(),
+            check,
+            types,
+            configuration,
+            device,
+            index,
+            std::vector<unsigned char>(sizeof(T))};
+    std::memcpy(e.input.data(), &input, sizeof(T));
+    record(e);
+  }
+
+  /** @brief Loads the corpus file given and enables replay mode
+   */
+  void load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    char file_magic[sizeof(magic)] = {};
+    uint32_t file_version = 0;
+    if (!in.read(file_magic, sizeof(file_magic)) ||
+        std::memcmp(file_magic, magic, sizeof(magic)) != 0 ||
+        !read_value(in, file_version) || file_version != version) {
+      throw std::runtime_error(path + " is not a failure corpus file");
+    }
+    m_entries.clear();
+    entry e;
+    while (read_string(in, e.test_case) && read_string(in, e.check) &&
+           read_string(in, e.types) && read_string(in, e.configuration) &&
+           read_string(in, e.device) && read_value(in, e.index) &&
+           read_bytes(in, e.input)) {
+      m_entries.push_back(e);
+    }
+    m_replaying = true;
+  }
+
+  bool is_replaying() const { return m_replaying; }
+
+  /** @brief Provides the names of the test cases with recorded entries,
+   *         without duplicates
+   */
+  std::vector<std::string> test_cases() const {
+    std::vector<std::string> result;
+    for (const auto& e : m_entries) {
+      bool found = false;
+      for (const auto& name : result) found = found || name == e.test_case;
+      if (!found) result.push_back(e.test_case);
+    }
+    return result;
+  }
+
+  /** @brief Provides the entries recorded for the given check of the
+   *         currently running test case
+   */
+  std::vector<entry> entries(const std::string& check,
+                             const std::string& types) const {
+    const std::string test_case =
+        Catch::getResultCapture().getCurrentTestName();
+    std::vector<entry> result;
+    for (const auto& e : m_entries) {
+      if (e.test_case == test_case && e.check == check && e.types == types) {
+        result.push_back(e);
+      }
+    }
+    return result;
+  }
+
+ private:
+  template <typename T>
+  static void write_value(std::ofstream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  static void write_string(std::ofstream& out, const std::string& value) {
+    write_value(out, static_cast<uint32_t>(value.size()));
+    out.write(value.data(), value.size());
+  }
+
+  template <typename T>
+  static bool read_value(std::ifstream& in, T& value) {
+    return static_cast<bool>(
+        in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+  }
+
+  static bool read_bytes(std::ifstream& in, std::vector<unsigned char>& bytes) {
+    uint32_t size = 0;
+    if (!read_value(in, size)) return false;
+    bytes.resize(size);
+    return size == 0 ||
+           static_cast<bool>(in.read(reinterpret_cast<char*>(bytes.data()),
+                                     size));
+  }
+
+  static bool read_string(std::ifstream& in, std::string& value) {
+    std::vector<unsigned char> bytes;
+    if (!read_bytes(in, bytes)) return false;
+    value.assign(bytes.begin(), bytes.end());
+    return true;
+  }
+
+  std::string m_output;
+  std::mutex m_mutex;
+  std::vector<entry> m_entries;
+  bool m_replaying = false;
+};
+
+}  // namespace sycl_cts::failure_corpus
+
+#endif  // __SYCLCTS_TESTS_COMMON_FAILURE_CORPUS_H
@@ -6,16 +6,151 @@
 //
 *******************************************************************************/
 
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
 #include <regex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #define CATCH_CONFIG_RUNNER
 #include <catch2/catch_session.hpp>
+#include <catch2/catch_test_case_info.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/internal/catch_clara.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
 
 #include "./../../util/device_manager.h"
+#include "./../../util/memory_tracker.h"
 #include "cts_selector.h"
+#include "failure_corpus.h"
+
+namespace {
+
+/** @brief File to write the memory report to, reporting is disabled if empty
+ */
+std::string memoryReportFile;
+
+/** @brief Records memory usage for each test case and writes it as JSON
+ *  @details Host memory is reported as a change of the process resident set
+ *           size, device memory as the bytes allocated through the CTS USM
+ *           and buffer helpers, see util/memory_tracker.h
+ */
+class memory_report_listener : public Catch::EventListenerBase {
+  using tracked_memory = sycl_cts::util::tracked_memory;
+  static constexpr size_t kinds_count =
+      static_cast<size_t>(tracked_memory::count);
+
+  struct record {
+    std::string name;
+    int64_t host_rss_delta;
+    size_t host_peak_rss_increase;
+    std::array<size_t, kinds_count> peak_bytes;
+    std::array<int64_t, kinds_count> live_bytes_delta;
+  };
+
+  sycl_cts::util::host_memory_usage m_host_at_start{};
+  bool m_host_peak_reset = false;
+  std::array<size_t, kinds_count> m_live_at_start{};
+  std::vector<record> m_records;
+
+  static std::string escape(const std::string& value) {
+    std::string result;
+    for (const char c : value) {
+      if (c == '"' || c == '\\') {
+        result += '\\';
+        result += c;
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        result += ' ';
+      } else {
+        result += c;
+      }
+    }
+    return result;
+  }
+
+ public:
+  using Catch::EventListenerBase::EventListenerBase;
+
+  void testCaseStarting(const Catch::TestCaseInfo&) override {
+    if (memoryReportFile.empty()) return;
+    auto& tracker = sycl_cts::util::get<sycl_cts::util::memory_tracker>();
+    tracker.reset_peaks();
+    for (size_t i = 0; i < kinds_count; ++i) {
+      m_live_at_start[i] = tracker.live(static_cast<tracked_memory>(i));
+    }
+    m_host_peak_reset = sycl_cts::util::reset_host_peak_rss();
+    m_host_at_start = sycl_cts::util::get_host_memory_usage();
+  }
+
+  void testCaseEnded(const Catch::TestCaseStats& stats) override {
+    if (memoryReportFile.empty()) return;
+    const auto host = sycl_cts::util::get_host_memory_usage();
+    const auto& tracker = sycl_cts::util::get<sycl_cts::util::memory_tracker>();
+
+    record result;
+    result.name = stats.testInfo->name;
+    result.host_rss_delta = static_cast<int64_t>(host.current_rss) -
+                            static_cast<int64_t>(m_host_at_start.current_rss);
+    // Without a reset, the process peak only grows if this test case exceeds
+    // the peak of all previous ones
+    const size_t baseline = m_host_peak_reset ? m_host_at_start.current_rss
+                                              : m_host_at_start.peak_rss;
+    result.host_peak_rss_increase =
+        host.peak_rss > baseline ? host.peak_rss - baseline : 0;
+    for (size_t i = 0; i < kinds_count; ++i) {
+      const auto kind = static_cast<tracked_memory>(i);
+      result.peak_bytes[i] = tracker.peak(kind) - m_live_at_start[i];
+      result.live_bytes_delta[i] = static_cast<int64_t>(tracker.live(kind)) -
+                                   static_cast<int64_t>(m_live_at_start[i]);
+    }
+    m_records.push_back(std::move(result));
+  }
+
+  void testRunEnded(const Catch::TestRunStats&) override {
+    if (memoryReportFile.empty()) return;
+    std::ofstream out(memoryReportFile);
+    out << "{\n  \"test_cases\": [";
+    for (size_t r = 0; r < m_records.size(); ++r) {
+      const auto& result = m_records[r];
+      out << (r == 0 ? "\n" : ",\n") << "    {\"name\": \""
+          << escape(result.name) << "\", "
+          << "\"host_rss_delta\": " << result.host_rss_delta << ", "
+          << "\"host_peak_rss_increase\": " << result.host_peak_rss_increase;
+      for (size_t i = 0; i < kinds_count; ++i) {
+        const char* kind = to_string(static_cast<tracked_memory>(i));
+        out << ", \"" << kind << "_peak\": " << result.peak_bytes[i]
+            << ", \"" << kind << "_live_delta\": "
+            << result.live_bytes_delta[i];
+      }
+      out << "}";
+    }
+    out << "\n  ]\n}\n";
+  }
+};
+
+/** @brief Escapes characters with a special meaning in Catch2 test specs,
+ *         so that the test case name given is matched literally
+ */
+std::string escape_test_spec(const std::string& name) {
+  std::string result;
+  for (const char c : name) {
+    if (c == '\\' || c == ',' || c == '[' || c == ']' || c == '*' ||
+        c == '"' || c == '~') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result;
+}
+
+}  // namespace
+
+CATCH_REGISTER_LISTENER(memory_report_listener)
 
 int main(int argc, char** argv) {
   using namespace sycl_cts;
@@ -25,6 +160,8 @@ int main(int argc, char** argv) {
 
   std::string devicePattern;
   std::string infoDumpFile;
+  std::string failureCorpusFile;
+  std::string replayFile;
   bool listDevices = false;
 
   using namespace Catch::Clara;
@@ -37,6 +174,14 @@ int main(int argc, char** argv) {
              Opt(listDevices)["--list-devices"]("List all available devices") |
              Opt(infoDumpFile, "file")["--info-dump"](
                  "Dump platform and device info to file") |
+             Opt(memoryReportFile, "file")["--memory-report"](
+                 "Write host and device memory usage of each test case to "
+                 "JSON file") |
+             Opt(failureCorpusFile, "file")["--failure-corpus"](
+                 "Append failing inputs of sweep checks to corpus file") |
+             Opt(replayFile, "file")["--replay"](
+                 "Run only the test cases and inputs recorded in corpus "
+                 "file") |
              session.cli();
 
   session.cli(cli);
@@ -46,6 +191,28 @@ int main(int argc, char** argv) {
     return returnCode;
   }
 
+  auto& corpus = util::get<failure_corpus::corpus>();
+  corpus.set_output(failureCorpusFile);
+  if (!replayFile.empty()) {
+    try {
+      corpus.load(replayFile);
+    } catch (const std::exception& e) {
+      std::cerr << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+    // Explicit test specs take precedence over the corpus content
+    auto& testSpecs = session.configData().testsOrTags;
+    if (testSpecs.empty()) {
+      for (const auto& name : corpus.test_cases()) {
+        testSpecs.push_back(escape_test_spec(name));
+      }
+    }
+    if (testSpecs.empty()) {
+      std::cout << "Failure corpus " << replayFile << " is empty" << std::endl;
+      return EXIT_SUCCESS;
+    }
+  }
+
   auto& device_mngr = util::get<util::device_manager>();
   if (!devicePattern.empty()) {
     device_mngr.set_device_regex(std::regex(devicePattern));
@@ -0,0 +1,72 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides buffer construction helpers registered within memory_tracker
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_MEMORY_TRACKING_H
+#define __SYCLCTS_TESTS_COMMON_MEMORY_TRACKING_H
+
+#include "../../util/memory_tracker.h"
+#include "common.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace memory_tracking {
+
+/** @brief Allocate host memory for buffer, registered within memory_tracker
+ *         until both buffer and its host data are released
+ */
+template <typename T>
+std::shared_ptr<T> allocate_tracked_host_data(size_t count) {
+  using sycl_cts::util::memory_tracker;
+  using sycl_cts::util::tracked_memory;
+
+  const size_t bytes = count * sizeof(T);
+  std::shared_ptr<T> host_data(new T[count](), [bytes](T* ptr) {
+    delete[] ptr;
+    sycl_cts::util::get<memory_tracker>().released(tracked_memory::buffer,
+                                                  bytes);
+  });
+  sycl_cts::util::get<memory_tracker>().allocated(tracked_memory::buffer,
+                                                  bytes);
+  return host_data;
+}
+
+/** @brief Construct a value-initialized buffer with tracked memory usage
+ */
+template <typename T, int Dims>
+sycl::buffer<T, Dims> make_buffer(const sycl::range<Dims>& range) {
+  return sycl::buffer<T, Dims>(allocate_tracked_host_data<T>(range.size()),
+                               range);
+}
+
+/** @brief Construct a buffer with tracked memory usage, initialized with a
+ *         copy of the data given
+ *  @details There is no write back to the data given on buffer destruction
+ */
+template <typename T, int Dims>
+sycl::buffer<T, Dims> make_buffer(const T* data,
+                                  const sycl::range<Dims>& range) {
+  auto host_data = allocate_tracked_host_data<T>(range.size());
+  std::copy(data, data + range.size(), host_data.get());
+  return sycl::buffer<T, Dims>(host_data, range);
+}
+
+/** @brief Construct a buffer with tracked memory usage, initialized with a
+ *         copy of the data given and writing back to it on destruction
+ */
+template <typename T, int Dims>
+sycl::buffer<T, Dims> make_write_back_buffer(T* data,
+                                             const sycl::range<Dims>& range) {
+  auto buffer = make_buffer(static_cast<const T*>(data), range);
+  buffer.set_final_data(data);
+  return buffer;
+}
+
+}  // namespace memory_tracking
+
+#endif  // __SYCLCTS_TESTS_COMMON_MEMORY_TRACKING_H
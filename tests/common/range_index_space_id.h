@@ -19,6 +19,8 @@
 //
 *******************************************************************************/
 
+#include "../common/memory_tracking.h"
+
 #ifndef SYCL_CTS_COMPILING_WITH_HIPSYCL
 #include "../common/type_coverage.h"
 #endif
@@ -71,7 +73,8 @@ void check_members_test(const std::string& type_name) {
   std::fill(result, result + check_count, false);
   SECTION(section_name) {
     {
-      sycl::buffer<bool, 1> res_buf(result, sycl::range(check_count));
+      auto res_buf = memory_tracking::make_write_back_buffer(
+          result, sycl::range<1>(check_count));
       queue.submit([&](sycl::handler& cgh) {
         sycl::accessor res_acc(res_buf, cgh);
         cgh.single_task<kernel_range_id<T, Dim>>(
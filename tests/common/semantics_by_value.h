@@ -22,6 +22,7 @@
 #define __SYCLCTS_TESTS_COMMON_SEMANTICS_BY_VALUE_H
 
 #include "common.h"
+#include "memory_tracking.h"
 
 #include <array>
 #include <string>
@@ -147,8 +148,8 @@ class on_device_checker {
     {
       // Perform comparisons on the passed items on the device side
       sycl::buffer<T> itemBuf(items.data(), sycl::range<1>(items.size()));
-      sycl::buffer<bool> successBuf(success.data(),
-                                    sycl::range<1>(success.size()));
+      auto successBuf = memory_tracking::make_write_back_buffer(
+          success.data(), sycl::range<1>(success.size()));
 
       auto queue = sycl_cts::util::get_cts_object::queue();
       queue
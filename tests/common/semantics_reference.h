@@ -22,6 +22,7 @@
 #define __SYCLCTS_TESTS_COMMON_SEMANTICS_BY_REFERENCE_H
 
 #include "common.h"
+#include "memory_tracking.h"
 
 #include <numeric>
 #include <string>
@@ -468,7 +469,8 @@ void check_kernel(InitFunc init_func, const std::string& type_name,
 
   std::vector<int> results(result_count, false);
   {
-    sycl::buffer<int> buffer(results.data(), sycl::range<1>{result_count});
+    auto buffer = memory_tracking::make_write_back_buffer(
+        results.data(), sycl::range<1>{result_count});
 
     queue.submit([&](sycl::handler& cgh) {
       auto accessor = buffer.template get_access<sycl::access_mode::write>(cgh);
@@ -47,6 +47,6 @@ class TEST_NAME : public util::test_base {
 };
 
 // register this test with the test_collection.
-util::test_proxy<TEST_NAME> proxy;
+util::test_proxy<TEST_NAME> proxy{TOSTRING(TEST_NAME)};
 
 } /* namespace TEST_NAMESPACE */
@@ -20,6 +20,7 @@
 
 #include <valarray>
 
+#include "../common/assertions.h"
 #include "group_functions_common.h"
 
 template <int D, typename T, typename U, typename I, typename OpT>
@@ -99,24 +100,18 @@ struct JointScanDataStruct {
     // scan results made over 'group' and 'sub_group' accordingly.
     for (int group_i = 0; group_i < 2; group_i++) {
       std::string group_name = group_i == 0 ? "group" : "sub_group";
-      size_t group_offset = range_size * group_i;
-      for (int i = 0; i < range_size; i++) {
-        // Each group contains two sets of results.
-        size_t res_i = i + 2 * group_offset;
-        {
-          INFO("Check joint_exclusive_scan on " + group_name + " for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i]));
-          INFO("Expected: " + std::to_string(reference_e[i]));
-          CHECK(res[res_i] == reference_e[i]);
-        }
-        {
-          INFO("Check joint_inclusive_scan on " + group_name + " for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i + range_size]));
-          INFO("Expected: " + std::to_string(reference_i[i]));
-          CHECK(res[res_i + range_size] == reference_i[i]);
-        }
+      // Each group contains two sets of results.
+      const U* res_e = res.data() + 2 * range_size * group_i;
+      const U* res_i = res_e + range_size;
+      {
+        INFO("Check joint_exclusive_scan on " + group_name +
+             " (Operator: " + op_name + ")");
+        CHECK_ALL_EQUAL(range_size, res_e, reference_e);
+      }
+      {
+        INFO("Check joint_inclusive_scan on " + group_name +
+             " (Operator: " + op_name + ")");
+        CHECK_ALL_EQUAL(range_size, res_i, reference_i);
       }
     }
   }
@@ -357,23 +352,17 @@ struct ScanOverGroupDataStruct {
       // There is only one work-group so we can scan over all the input data.
       std::exclusive_scan(ref_input.begin(), ref_input.end(), reference.begin(),
                           init_value, op);
-      for (int i = 0; i < range_size; i++) {
-        int res_i = i;
-        INFO("Check exclusive_scan_over_group on group for element " +
-             std::to_string(i) + " (Operator: " + op_name + ")");
-        INFO("Result: " + std::to_string(res[res_i]));
-        INFO("Expected: " + std::to_string(reference[i]));
-        CHECK(res[res_i] == reference[i]);
+      {
+        INFO("Check exclusive_scan_over_group on group (Operator: " + op_name +
+             ")");
+        CHECK_ALL_EQUAL(range_size, res.data(), reference);
       }
       std::inclusive_scan(ref_input.begin(), ref_input.end(), reference.begin(),
                           op, init_value);
-      for (int i = 0; i < range_size; i++) {
-        int res_i = range_size + i;
-        INFO("Check inclusive_scan_over_group on group for element " +
-             std::to_string(i) + " (Operator: " + op_name + ")");
-        INFO("Result: " + std::to_string(res[res_i]));
-        INFO("Expected: " + std::to_string(reference[i]));
-        CHECK(res[res_i] == reference[i]);
+      {
+        INFO("Check inclusive_scan_over_group on group (Operator: " + op_name +
+             ")");
+        CHECK_ALL_EQUAL(range_size, res.data() + range_size, reference);
       }
     }
     {
@@ -389,7 +378,9 @@ struct ScanOverGroupDataStruct {
         // Place the data identified by (sgid, lid).
         input_vec[lid] = ref_input[i];
       }
-      // Compute the reference results and verify.
+      // Compute the reference results.
+      std::vector<T> reference_e(range_size, T(-1));
+      std::vector<T> reference_i(range_size, T(-1));
       for (int i = 0; i < range_size; i++) {
         size_t sgid = sub_group_id[i];
         size_t lid = local_id[i];
@@ -399,24 +390,21 @@ struct ScanOverGroupDataStruct {
         std::vector<T> reference(lid + 1, T(-1));
         std::exclusive_scan(input_vec.begin(), input_vec.begin() + lid + 1,
                             reference.begin(), init_value, op);
-        {
-          int res_i = range_size * 2 + i;
-          INFO("Check exclusive_scan_over_group on sub_group for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i]));
-          INFO("Expected: " + std::to_string(reference[lid]));
-          CHECK(res[res_i] == reference[lid]);
-        }
+        reference_e[i] = reference[lid];
         std::inclusive_scan(input_vec.begin(), input_vec.begin() + lid + 1,
                             reference.begin(), op, init_value);
-        {
-          int res_i = range_size * 3 + i;
-          INFO("Check inclusive_scan_over_group on sub_group for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i]));
-          INFO("Expected: " + std::to_string(reference[lid]));
-          CHECK(res[res_i] == reference[lid]);
-        }
+        reference_i[i] = reference[lid];
+      }
+      // Verify.
+      {
+        INFO("Check exclusive_scan_over_group on sub_group (Operator: " +
+             op_name + ")");
+        CHECK_ALL_EQUAL(range_size, res.data() + range_size * 2, reference_e);
+      }
+      {
+        INFO("Check inclusive_scan_over_group on sub_group (Operator: " +
+             op_name + ")");
+        CHECK_ALL_EQUAL(range_size, res.data() + range_size * 3, reference_i);
       }
     }
   }
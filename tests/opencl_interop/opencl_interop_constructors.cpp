@@ -395,6 +395,6 @@ class TEST_NAME :
 };
 
 // register this test with the test_collection
-util::test_proxy<TEST_NAME> proxy;
+util::test_proxy<TEST_NAME> proxy{TOSTRING(TEST_NAME)};
 
 } /* namespace opencl_interop_constructors__ */
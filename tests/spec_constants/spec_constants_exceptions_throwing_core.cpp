@@ -43,6 +43,6 @@ class TEST_NAME : public util::test_base {
 };
 
 // construction of this proxy will register the test above
-util::test_proxy<TEST_NAME> proxy;
+util::test_proxy<TEST_NAME> proxy{TOSTRING(TEST_NAME)};
 
 }  // namespace TEST_NAMESPACE
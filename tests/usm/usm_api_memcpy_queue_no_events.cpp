@@ -38,6 +38,6 @@ class TEST_NAME : public sycl_cts::util::test_base {
 };
 
 // construction of this proxy will register the above test
-sycl_cts::util::test_proxy<TEST_NAME> proxy;
+sycl_cts::util::test_proxy<TEST_NAME> proxy{TOSTRING(TEST_NAME)};
 
 }  // namespace TEST_NAMESPACE
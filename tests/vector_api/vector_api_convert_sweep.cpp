@@ -0,0 +1,45 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "vector_api_convert_sweep.h"
+
+namespace vector_api_convert_sweep {
+
+TEST_CASE("vec::convert rounding modes sweep, float to int32",
+          "[vector_api][convert_sweep]") {
+  run_sweep_all_modes<float, int32_t>("float", "int32_t");
+}
+
+TEST_CASE("vec::convert rounding modes sweep, float to uint32",
+          "[vector_api][convert_sweep]") {
+  run_sweep_all_modes<float, uint32_t>("float", "uint32_t");
+}
+
+TEST_CASE("vec::convert rounding modes sweep, int32 to float",
+          "[vector_api][convert_sweep]") {
+  run_sweep_all_modes<int32_t, float>("int32_t", "float");
+}
+
+TEST_CASE("vec::convert rounding modes sweep, uint32 to float",
+          "[vector_api][convert_sweep]") {
+  run_sweep_all_modes<uint32_t, float>("uint32_t", "float");
+}
+
+}  // namespace vector_api_convert_sweep
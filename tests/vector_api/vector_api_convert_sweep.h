@@ -0,0 +1,462 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides a sweep engine verifying vec::convert with explicit rounding
+//  modes over whole input spaces.
+//
+//  Inputs are generated on the device from their index, converted in chunks
+//  and compared against a host reference that runs in parallel threads, each
+//  with its host rounding mode set through the oclmath rounding_mode helpers.
+//  In full conformance mode 32-bit input spaces are swept exhaustively,
+//  otherwise a dense strided subset is used. 16-bit input spaces are always
+//  swept exhaustively. 64-bit inputs are swept over pseudo-random patterns
+//  concentrated around the destination range.
+//  Mismatching inputs are recorded to the failure corpus, if enabled. In
+//  replay mode, only the recorded inputs are converted, using the same
+//  kernel code.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_VECTOR_API_VECTOR_API_CONVERT_SWEEP_H
+#define __SYCLCTS_TESTS_VECTOR_API_VECTOR_API_CONVERT_SWEEP_H
+
+#include "../common/common.h"
+#include "../common/failure_corpus.h"
+#include "../common/once_per_unit.h"
+
+#include "../../oclmath/rounding_mode.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace vector_api_convert_sweep {
+using namespace sycl_cts;
+
+// Each work-item converts one vector of this size
+constexpr int vec_size = 4;
+// Number of elements converted per kernel launch
+constexpr uint64_t chunk_size = uint64_t{1} << 22;
+// Number of mismatches to report in detail
+constexpr size_t max_reported_mismatches = 8;
+// Number of mismatches to record to the failure corpus for each sweep
+constexpr size_t max_recorded_mismatches = 256;
+
+template <typename T>
+using bits_t = std::conditional_t<
+    sizeof(T) == 2, uint16_t,
+    std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+
+template <typename T>
+constexpr bool is_fp_v = std::is_floating_point_v<T> ||
+                         std::is_same_v<T, sycl::half>;
+
+inline uint64_t splitmix64(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/** @brief Describes the part of the input space of SrcT that is swept
+ */
+template <typename SrcT>
+struct sweep_space {
+  static uint64_t count() {
+    if constexpr (sizeof(SrcT) == 2) {
+      return uint64_t{1} << 16;
+    } else if constexpr (sizeof(SrcT) == 4) {
+#if SYCL_CTS_ENABLE_FULL_CONFORMANCE
+      return uint64_t{1} << 32;
+#else
+      return uint64_t{1} << 24;
+#endif
+    } else {
+#if SYCL_CTS_ENABLE_FULL_CONFORMANCE
+      return uint64_t{1} << 28;
+#else
+      return uint64_t{1} << 22;
+#endif
+    }
+  }
+
+  /** @brief Describes how indices are mapped to inputs by make_input;
+   *         recorded to the failure corpus along with the index
+   */
+  static std::string configuration() {
+    if constexpr (sizeof(SrcT) == 2) {
+      return "bits";
+    } else if constexpr (sizeof(SrcT) == 4) {
+#if SYCL_CTS_ENABLE_FULL_CONFORMANCE
+      return "bits";
+#else
+      return "bits, stride 257";
+#endif
+    } else {
+      return is_fp_v<SrcT> ? "splitmix64, exponents [-2, 66)" : "splitmix64";
+    }
+  }
+
+  /** @brief Generates the input with the index given; used both on host and
+   *         on device
+   */
+  static SrcT make_input(uint64_t index) {
+    using bits = bits_t<SrcT>;
+    if constexpr (sizeof(SrcT) == 2) {
+      return sycl::bit_cast<SrcT>(static_cast<bits>(index));
+    } else if constexpr (sizeof(SrcT) == 4) {
+#if SYCL_CTS_ENABLE_FULL_CONFORMANCE
+      return sycl::bit_cast<SrcT>(static_cast<bits>(index));
+#else
+      // Stride coprime to 2^32 spreading the subset over the whole space
+      return sycl::bit_cast<SrcT>(static_cast<bits>(index * 257));
+#endif
+    } else {
+      const uint64_t hash = splitmix64(index);
+      if constexpr (is_fp_v<SrcT>) {
+        // Random sign and mantissa with exponents in [2^-2, 2^66), which
+        // covers rounding of fractional values and the bounds of all
+        // integer destination types
+        const uint64_t sign = hash >> 63;
+        const uint64_t exponent = 1021 + (hash >> 52) % 69;
+        const uint64_t mantissa = hash & ((uint64_t{1} << 52) - 1);
+        return sycl::bit_cast<SrcT>(
+            static_cast<bits>(sign << 63 | exponent << 52 | mantissa));
+      } else {
+        return sycl::bit_cast<SrcT>(static_cast<bits>(hash));
+      }
+    }
+  }
+};
+
+inline RoundingMode to_host_rounding_mode(sycl::rounding_mode mode) {
+  switch (mode) {
+    case sycl::rounding_mode::rte:
+      return kRoundToNearestEven;
+    case sycl::rounding_mode::rtz:
+      return kRoundTowardZero;
+    case sycl::rounding_mode::rtp:
+      return kRoundUp;
+    case sycl::rounding_mode::rtn:
+      return kRoundDown;
+    default:
+      return kDefaultRoundingMode;
+  }
+}
+
+template <typename T>
+Type to_host_type() {
+  if constexpr (is_fp_v<T>) {
+    return sizeof(T) == 8 ? kdouble : kfloat;
+  } else if constexpr (sizeof(T) == 1) {
+    return std::is_signed_v<T> ? kchar : kuchar;
+  } else if constexpr (sizeof(T) == 2) {
+    return std::is_signed_v<T> ? kshort : kushort;
+  } else if constexpr (sizeof(T) == 4) {
+    return std::is_signed_v<T> ? kint : kuint;
+  } else {
+    return std::is_signed_v<T> ? klong : kulong;
+  }
+}
+
+/** @brief Computes the reference conversion using the current host rounding
+ *         mode
+ *  @retval false if the conversion is undefined for the input given, e.g. a
+ *          floating point value out of the range of an integer type
+ */
+template <typename SrcT, typename DstT>
+bool convert_reference(SrcT input, DstT& result) {
+  if constexpr (is_fp_v<SrcT> && !is_fp_v<DstT>) {
+    // Exact for all floating point source types
+    const double value = static_cast<double>(input);
+    if (!std::isfinite(value)) return false;
+    const double rounded = std::nearbyint(value);
+    // Bounds are powers of two and therefore exactly representable
+    const double upper = std::ldexp(1.0, std::numeric_limits<DstT>::digits);
+    const double lower = std::is_signed_v<DstT> ? -upper : 0.0;
+    if (!(rounded >= lower && rounded < upper)) return false;
+    result = static_cast<DstT>(rounded);
+    return true;
+  } else {
+    // Integer to floating point conversions round according to the current
+    // host rounding mode
+    result = static_cast<DstT>(input);
+    return true;
+  }
+}
+
+/** @brief Provides the input with denormal values flushed to zero of the same
+ *         sign, as done by devices without denormal support
+ */
+template <typename T>
+T flush_denormal(T value) {
+  if constexpr (is_fp_v<T>) {
+    using bits = bits_t<T>;
+    constexpr int mantissa_bits =
+        sizeof(T) == 2 ? 10 : (sizeof(T) == 4 ? 23 : 52);
+    constexpr bits magnitude_mask = std::numeric_limits<bits>::max() >> 1;
+    constexpr bits mantissa_mask = (bits{1} << mantissa_bits) - 1;
+    constexpr bits exponent_mask =
+        static_cast<bits>(magnitude_mask & ~mantissa_mask);
+    const bits value_bits = sycl::bit_cast<bits>(value);
+    if ((value_bits & exponent_mask) == 0 &&
+        (value_bits & mantissa_mask) != 0) {
+      return sycl::bit_cast<T>(
+          static_cast<bits>(value_bits & ~magnitude_mask));
+    }
+  }
+  return value;
+}
+
+template <typename SrcT, typename DstT>
+struct mismatch {
+  uint64_t index;
+  SrcT input;
+  DstT expected;
+  DstT actual;
+};
+
+/** @brief Converts the vec of inputs with the given indices; shared by the
+ *         sweep and the replay kernels
+ */
+template <typename SrcT, typename DstT, sycl::rounding_mode Mode,
+          typename IndexT, typename ResultsT>
+void convert_inputs(const IndexT& index_of, size_t first_result,
+                    const ResultsT& results) {
+  sycl::vec<SrcT, vec_size> input;
+  for (int i = 0; i < vec_size; ++i) {
+    input[i] = sweep_space<SrcT>::make_input(index_of(i));
+  }
+  const auto converted = input.template convert<DstT, Mode>();
+  for (int i = 0; i < vec_size; ++i) {
+    results[first_result + i] = converted[i];
+  }
+}
+
+/** @brief Compares device results with the host reference using all
+ *         available host threads
+ *  @param index_of Provides the input index of the result given
+ *  @param flush_denorms Whether the device might flush denormal inputs; the
+ *         results for those are accepted if they match the reference either
+ *         with or without flushing
+ *  @retval Number of mismatches; the first few are appended to mismatches
+ */
+template <typename SrcT, typename DstT, sycl::rounding_mode Mode,
+          typename IndexT>
+uint64_t verify_results(const IndexT& index_of, const DstT* results,
+                        uint64_t count, bool flush_denorms,
+                        std::vector<mismatch<SrcT, DstT>>& mismatches) {
+  const unsigned num_threads =
+      std::max(1u, std::thread::hardware_concurrency());
+  const uint64_t per_thread = (count + num_threads - 1) / num_threads;
+  std::vector<uint64_t> mismatch_counts(num_threads, 0);
+  std::mutex mismatches_mutex;
+
+  auto worker = [&](unsigned thread_index) {
+    const uint64_t begin = thread_index * per_thread;
+    const uint64_t end = std::min(count, begin + per_thread);
+    // The host floating point environment is per thread
+    const RoundingMode old_mode =
+        set_round(to_host_rounding_mode(Mode), to_host_type<DstT>());
+
+    for (uint64_t i = begin; i < end; ++i) {
+      const uint64_t index = index_of(i);
+      const SrcT input = sweep_space<SrcT>::make_input(index);
+      DstT expected;
+      if (!convert_reference(input, expected)) continue;
+      if (expected == results[i]) continue;
+      if (flush_denorms) {
+        const SrcT flushed_input = flush_denormal(input);
+        DstT flushed;
+        if (sycl::bit_cast<bits_t<SrcT>>(flushed_input) !=
+                sycl::bit_cast<bits_t<SrcT>>(input) &&
+            convert_reference(flushed_input, flushed) &&
+            flushed == results[i]) {
+          continue;
+        }
+      }
+      ++mismatch_counts[thread_index];
+      std::lock_guard<std::mutex> lock(mismatches_mutex);
+      if (mismatches.size() < max_recorded_mismatches) {
+        mismatches.push_back({index, input, expected, results[i]});
+      }
+    }
+
+    set_round(old_mode, to_host_type<DstT>());
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (unsigned t = 0; t < num_threads; ++t) threads.emplace_back(worker, t);
+  for (auto& thread : threads) thread.join();
+
+  uint64_t total = 0;
+  for (const auto c : mismatch_counts) total += c;
+  return total;
+}
+
+/** @brief Checks whether the device flushes denormal inputs of SrcT
+ */
+template <typename SrcT>
+bool device_flushes_denorms(const sycl::device& device) {
+  std::vector<sycl::info::fp_config> config;
+  if constexpr (std::is_same_v<SrcT, sycl::half>) {
+    config = device.get_info<sycl::info::device::half_fp_config>();
+  } else if constexpr (std::is_same_v<SrcT, float>) {
+    config = device.get_info<sycl::info::device::single_fp_config>();
+  } else if constexpr (std::is_same_v<SrcT, double>) {
+    config = device.get_info<sycl::info::device::double_fp_config>();
+  } else {
+    return false;
+  }
+  return std::find(config.begin(), config.end(),
+                   sycl::info::fp_config::denorm) == config.end();
+}
+
+/** @brief Converts only the inputs recorded in the failure corpus
+ */
+template <typename SrcT, typename DstT, sycl::rounding_mode Mode>
+uint64_t replay(sycl::queue& queue, const std::vector<uint64_t>& indices,
+                bool flush_denorms,
+                std::vector<mismatch<SrcT, DstT>>& mismatches) {
+  // Pad to whole vectors by repeating the last input
+  std::vector<uint64_t> padded = indices;
+  padded.resize((indices.size() + vec_size - 1) / vec_size * vec_size,
+                indices.back());
+  sycl::buffer<uint64_t, 1> indices_buf{padded.data(),
+                                        sycl::range<1>{padded.size()}};
+  sycl::buffer<DstT, 1> results_buf{sycl::range<1>{padded.size()}};
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor in{indices_buf, cgh, sycl::read_only};
+    sycl::accessor results{results_buf, cgh, sycl::write_only, sycl::no_init};
+    cgh.parallel_for(sycl::range<1>{padded.size() / vec_size},
+                     [=](sycl::id<1> id) {
+                       const size_t base = id[0] * vec_size;
+                       convert_inputs<SrcT, DstT, Mode>(
+                           [&](int i) { return in[base + i]; }, base, results);
+                     });
+  });
+  sycl::host_accessor results{results_buf, sycl::read_only};
+  return verify_results<SrcT, DstT, Mode>(
+      [&](uint64_t i) { return indices[i]; }, results.get_pointer(),
+      indices.size(), flush_denorms, mismatches);
+}
+
+template <typename SrcT, typename DstT, sycl::rounding_mode Mode>
+void run_sweep(const std::string& src_name, const std::string& dst_name,
+               const std::string& mode_name) {
+  auto queue = once_per_unit::get_queue();
+  const uint64_t total = sweep_space<SrcT>::count();
+  const uint64_t chunk = std::min(total, chunk_size);
+  const bool flush_denorms = device_flushes_denorms<SrcT>(queue.get_device());
+  const std::string check = "vec::convert<" + mode_name + ">";
+  const std::string types = src_name + "," + dst_name;
+
+  const std::string configuration = sweep_space<SrcT>::configuration();
+  auto& corpus = util::get<failure_corpus::corpus>();
+
+  std::vector<uint64_t> indices;
+  if (corpus.is_replaying()) {
+    for (const auto& e : corpus.entries(check, types)) {
+      // Indices only identify the same inputs if they are mapped the same way
+      const auto recorded = e.input_as<SrcT>();
+      const SrcT input = sweep_space<SrcT>::make_input(e.index);
+      if (e.configuration != configuration || recorded.size() != 1 ||
+          std::memcmp(&recorded[0], &input, sizeof(SrcT)) != 0) {
+        FAIL("Failure corpus entry for index "
+             << e.index << " was recorded with sweep configuration \""
+             << e.configuration << "\", this build uses \"" << configuration
+             << "\"");
+      }
+      indices.push_back(e.index);
+    }
+    if (indices.empty()) return;
+  }
+  INFO("vec<" << src_name << ">::convert<" << dst_name << ", " << mode_name
+              << "> over "
+              << (corpus.is_replaying() ? indices.size() : total)
+              << (corpus.is_replaying() ? " recorded inputs" : " inputs"));
+
+  std::vector<mismatch<SrcT, DstT>> mismatches;
+  uint64_t mismatch_count = 0;
+  if (corpus.is_replaying()) {
+    mismatch_count = replay<SrcT, DstT, Mode>(queue, indices, flush_denorms,
+                                              mismatches);
+  } else {
+    sycl::buffer<DstT, 1> results_buf{sycl::range<1>{chunk}};
+    for (uint64_t first = 0; first < total; first += chunk) {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor results{results_buf, cgh, sycl::write_only,
+                               sycl::no_init};
+        cgh.parallel_for(sycl::range<1>{chunk / vec_size},
+                         [=](sycl::id<1> id) {
+                           const uint64_t base = first + id[0] * vec_size;
+                           convert_inputs<SrcT, DstT, Mode>(
+                               [&](int i) { return base + i; },
+                               id[0] * vec_size, results);
+                         });
+      });
+      sycl::host_accessor results{results_buf, sycl::read_only};
+      mismatch_count += verify_results<SrcT, DstT, Mode>(
+          [&](uint64_t i) { return first + i; }, results.get_pointer(), chunk,
+          flush_denorms, mismatches);
+    }
+  }
+
+  const std::string device =
+      queue.get_device().get_info<sycl::info::device::name>();
+  for (size_t m = 0; m < mismatches.size(); ++m) {
+    const auto& failure = mismatches[m];
+    // Recorded inputs are already part of the corpus being replayed
+    if (!corpus.is_replaying()) {
+      corpus.record(check, types, configuration, device, failure.index,
+                    failure.input);
+    }
+    if (m >= max_reported_mismatches) continue;
+    std::ostringstream message;
+    message << "index " << failure.index << ": input "
+            << Catch::StringMaker<SrcT>::convert(failure.input)
+            << ", expected "
+            << Catch::StringMaker<DstT>::convert(failure.expected)
+            << ", got " << Catch::StringMaker<DstT>::convert(failure.actual);
+    UNSCOPED_INFO(message.str());
+  }
+  CHECK(mismatch_count == 0);
+}
+
+/** @brief Runs the sweep for all explicit rounding modes
+ */
+template <typename SrcT, typename DstT>
+void run_sweep_all_modes(const std::string& src_name,
+                         const std::string& dst_name) {
+  run_sweep<SrcT, DstT, sycl::rounding_mode::rte>(src_name, dst_name, "rte");
+  run_sweep<SrcT, DstT, sycl::rounding_mode::rtz>(src_name, dst_name, "rtz");
+  run_sweep<SrcT, DstT, sycl::rounding_mode::rtp>(src_name, dst_name, "rtp");
+  run_sweep<SrcT, DstT, sycl::rounding_mode::rtn>(src_name, dst_name, "rtn");
+}
+
+}  // namespace vector_api_convert_sweep
+
+#endif  // __SYCLCTS_TESTS_VECTOR_API_VECTOR_API_CONVERT_SWEEP_H
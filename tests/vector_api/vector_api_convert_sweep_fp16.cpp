@@ -0,0 +1,35 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "vector_api_convert_sweep.h"
+
+namespace vector_api_convert_sweep {
+
+TEST_CASE("vec::convert rounding modes sweep, half to int16 and int32",
+          "[vector_api][convert_sweep]") {
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp16)) {
+    SKIP("Device does not support half precision floating point operations");
+  }
+  run_sweep_all_modes<sycl::half, int16_t>("sycl::half", "int16_t");
+  run_sweep_all_modes<sycl::half, int32_t>("sycl::half", "int32_t");
+}
+
+}  // namespace vector_api_convert_sweep
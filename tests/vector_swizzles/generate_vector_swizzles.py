@@ -49,18 +49,29 @@ def main():
     argparser.add_argument(
         '-batch_index',
         dest='batch_index',
-        required=True,
         type=int,
-        help='Batch index of the test batch to write to the output file.') 
+        help='Batch index of the test batch to write to the output file. '
+        'If omitted, all batches are written in a single pass.')
     argparser.add_argument(
         '-o',
         required=True,
         dest="output",
+        nargs='+',
         metavar='<out file>',
-        help='CTS test output')
+        help='CTS test output. One file per batch is required if '
+        '-batch_index is omitted')
     args = argparser.parse_args()
 
-    make_swizzles_tests(args.ty, args.template, args.output, args.num_batches, args.batch_index - 1)
+    if args.batch_index is None:
+        batch_indices = list(range(args.num_batches))
+    else:
+        batch_indices = [args.batch_index - 1]
+    if len(args.output) != len(batch_indices):
+        argparser.error('expected {} output files, got {}'.format(
+            len(batch_indices), len(args.output)))
+
+    make_swizzles_tests(args.ty, args.template, args.output, args.num_batches,
+                        batch_indices)
 
 
 if __name__ == '__main__':
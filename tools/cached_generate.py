@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+
+"""
+Utility script for running a CTS test source generator.
+Not intended for manual use; invoked by `generate_cts_test` in
+tests/CMakeLists.txt.
+
+The generator is run on a temporary output and the result is only copied to
+the real output file if its content has changed. This keeps the timestamps of
+byte-identical generated sources untouched, so that the build system does not
+recompile them.
+
+Additionally, generator outputs can be cached in a directory, keyed by a hash
+of the generator command line and the content of all files it depends on.
+Besides the files declared with --depends, these include all modules within
+the source tree that the generator imports, directly or indirectly.
+To configure the cache location, specify SYCL_CTS_GENERATOR_CACHE_DIR during
+CMake configuration. Cache entries are refreshed whenever they are used, and
+entries unused for longer than --max-age-days are evicted when new entries are
+written next to them. The cache can also be cleared at any time by deleting
+the directory.
+"""
+
+import argparse
+import ast
+import hashlib
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# Bump this to invalidate all existing cache entries
+CACHE_VERSION = 1
+# Cache entries unused for this many days are evicted
+DEFAULT_MAX_AGE_DAYS = 30
+# Only modules within this directory are considered generator dependencies
+SOURCE_ROOT = os.path.dirname(os.path.dirname(os.path.realpath(__file__)))
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        description="Runs a test source generator with output caching.")
+    parser.add_argument('--cache-dir', type=str, default='',
+                        help="Directory to cache generator outputs in. "
+                        "Caching is disabled if empty.")
+    parser.add_argument('--max-age-days', type=float,
+                        default=DEFAULT_MAX_AGE_DAYS,
+                        help="Evict cache entries unused for longer than "
+                        "this many days")
+    parser.add_argument('--depends', type=str, action='append', default=[],
+                        help="File the generator output depends on")
+    parser.add_argument('--output', type=str, action='append', required=True,
+                        help="Path of a generated output file. May be "
+                        "specified multiple times for generators producing "
+                        "several files in one invocation.")
+    parser.add_argument('command', nargs=argparse.REMAINDER,
+                        help="Generator command line, without the output "
+                        "argument ('-o <file>...' is appended)")
+    args = parser.parse_args()
+    if args.command and args.command[0] == '--':
+        args.command = args.command[1:]
+    if not args.command:
+        parser.error("no generator command given")
+    return args
+
+
+def is_sys_path_update(node):
+    """
+    Checks whether the AST node given is a sys.path.append or sys.path.insert
+    call with a literal path.
+    """
+    return (isinstance(node, ast.Call) and
+            isinstance(node.func, ast.Attribute) and
+            node.func.attr in ('append', 'insert') and
+            isinstance(node.func.value, ast.Attribute) and
+            node.func.value.attr == 'path' and
+            isinstance(node.func.value.value, ast.Name) and
+            node.func.value.value.id == 'sys' and
+            node.args and isinstance(node.args[-1], ast.Constant) and
+            isinstance(node.args[-1].value, str))
+
+
+def resolve_module(name, search_dirs):
+    """
+    Provides the source file of the module given within the source tree, or
+    None if it is not found there, e.g. for standard library modules.
+    """
+    for directory in search_dirs:
+        base = os.path.join(directory, *name.split('.'))
+        for candidate in (base + '.py', os.path.join(base, '__init__.py')):
+            candidate = os.path.realpath(candidate)
+            if os.path.isfile(candidate) and \
+                    os.path.commonpath([candidate, SOURCE_ROOT]) == SOURCE_ROOT:
+                return candidate
+    return None
+
+
+def find_imported_modules(script):
+    """
+    Provides the source files within the source tree of all modules imported
+    by the script given, directly or indirectly. Directories added to
+    sys.path with literal paths are resolved relative to the working
+    directory, as the generators are run from their source directory.
+    """
+    extra_dirs = []
+    found = set()
+    pending = [os.path.realpath(script)]
+    visited = set()
+    while pending:
+        path = pending.pop()
+        if path in visited:
+            continue
+        visited.add(path)
+        with open(path, 'rb') as f:
+            tree = ast.parse(f.read(), path)
+
+        names = []
+        for node in ast.walk(tree):
+            if is_sys_path_update(node):
+                extra_dirs.append(os.path.abspath(node.args[-1].value))
+            elif isinstance(node, ast.Import):
+                names += [(alias.name, None) for alias in node.names]
+            elif isinstance(node, ast.ImportFrom):
+                base_dirs = None
+                if node.level > 0:
+                    # Relative import, resolved against the importing package
+                    package_dir = path
+                    for _ in range(node.level):
+                        package_dir = os.path.dirname(package_dir)
+                    base_dirs = [package_dir]
+                module = node.module or ''
+                candidates = [module] if module else []
+                # The imported names might be submodules
+                candidates += [(module + '.' if module else '') + alias.name
+                               for alias in node.names]
+                names += [(name, base_dirs) for name in candidates]
+
+        for name, base_dirs in names:
+            search_dirs = base_dirs or [os.path.dirname(path)] + extra_dirs
+            module_path = resolve_module(name, search_dirs)
+            if module_path is not None:
+                found.add(module_path)
+                pending.append(module_path)
+    return found
+
+
+def compute_cache_key(command, depends, output_names):
+    h = hashlib.sha256()
+    h.update(f"v{CACHE_VERSION}\0".encode())
+    # The output names are part of the key as some generators embed them into
+    # the generated source.
+    for name in output_names:
+        h.update(name.encode() + b'\0')
+    # The interpreter is not hashed, only the actual generator arguments.
+    for arg in command[1:]:
+        h.update(arg.encode() + b'\0')
+    # The generator script itself is expected to be the first argument
+    dependencies = set(os.path.realpath(d) for d in depends)
+    if len(command) > 1 and command[1].endswith('.py'):
+        dependencies |= find_imported_modules(command[1])
+    for dep in sorted(dependencies):
+        with open(dep, 'rb') as f:
+            h.update(hashlib.sha256(f.read()).digest())
+    return h.hexdigest()
+
+
+def write_if_changed(path: str, content: bytes):
+    """
+    Writes content to path, unless the file already contains exactly that.
+    Returns whether the file was written.
+    """
+    try:
+        with open(path, 'rb') as f:
+            if f.read() == content:
+                return False
+    except FileNotFoundError:
+        pass
+
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    tmp_path = f"{path}.tmp.{os.getpid()}"
+    with open(tmp_path, 'wb') as f:
+        f.write(content)
+    # Atomically swap in the new content
+    os.replace(tmp_path, path)
+    return True
+
+
+def prune_cache(shard_dir: str, max_age_days: float):
+    """
+    Removes entries from a cache shard that have not been used for longer than
+    max_age_days. Only the shard being written to is pruned, so that the cost
+    is spread over the generator invocations.
+    """
+    cutoff = time.time() - max_age_days * 24 * 60 * 60
+    try:
+        entries = os.scandir(shard_dir)
+    except FileNotFoundError:
+        return
+    with entries:
+        for entry in entries:
+            try:
+                if entry.is_file() and entry.stat().st_mtime < cutoff:
+                    os.remove(entry.path)
+            except FileNotFoundError:
+                # Removed concurrently by another invocation
+                pass
+
+
+def run_generator(command, output_names):
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        tmp_outputs = [os.path.join(tmp_dir, name) for name in output_names]
+        p = subprocess.run(command + ['-o'] + tmp_outputs)
+        if p.returncode != 0:
+            sys.exit(p.returncode)
+        contents = []
+        for tmp_output in tmp_outputs:
+            with open(tmp_output, 'rb') as f:
+                contents.append(f.read())
+        return contents
+
+
+def main():
+    args = parse_arguments()
+    output_names = [os.path.basename(o) for o in args.output]
+
+    contents = None
+    cache_files = []
+    if args.cache_dir:
+        key = compute_cache_key(args.command, args.depends, output_names)
+        cache_files = [os.path.join(args.cache_dir, key[:2], f"{key}.{i}")
+                       for i in range(len(output_names))]
+        try:
+            contents = []
+            for cache_file in cache_files:
+                with open(cache_file, 'rb') as f:
+                    contents.append(f.read())
+            # Mark the entry as recently used, to keep it from being evicted
+            for cache_file in cache_files:
+                os.utime(cache_file)
+        except FileNotFoundError:
+            contents = None
+
+    if contents is None:
+        contents = run_generator(args.command, output_names)
+        if cache_files:
+            prune_cache(os.path.dirname(cache_files[0]), args.max_age_days)
+        for cache_file, content in zip(cache_files, contents):
+            write_if_changed(cache_file, content)
+
+    for output, content in zip(args.output, contents):
+        write_if_changed(output, content)
+
+
+if __name__ == '__main__':
+    main()
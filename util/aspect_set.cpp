@@ -17,31 +17,13 @@ namespace detail {
 #define ASPECT_SET_IMPL_MAP_NAME(aspectName) \
   case sycl::aspect::aspectName:             \
     result = TOSTRING(aspectName);           \
-    break
+    break;
 
 inline std::string map_name(sycl::aspect value) {
   std::string result{"n/a"};
 
   switch (value) {
-    ASPECT_SET_IMPL_MAP_NAME(cpu);
-    ASPECT_SET_IMPL_MAP_NAME(gpu);
-    ASPECT_SET_IMPL_MAP_NAME(accelerator);
-    ASPECT_SET_IMPL_MAP_NAME(custom);
-    // ASPECT_SET_IMPL_MAP_NAME(emulated);
-    // ASPECT_SET_IMPL_MAP_NAME(host_debuggable);
-    ASPECT_SET_IMPL_MAP_NAME(fp16);
-    ASPECT_SET_IMPL_MAP_NAME(fp64);
-    ASPECT_SET_IMPL_MAP_NAME(atomic64);
-    ASPECT_SET_IMPL_MAP_NAME(image);
-    ASPECT_SET_IMPL_MAP_NAME(online_compiler);
-    ASPECT_SET_IMPL_MAP_NAME(online_linker);
-    ASPECT_SET_IMPL_MAP_NAME(queue_profiling);
-    ASPECT_SET_IMPL_MAP_NAME(usm_device_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_host_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_atomic_host_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_shared_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_atomic_shared_allocations);
-    ASPECT_SET_IMPL_MAP_NAME(usm_system_allocations);
+    SYCL_CTS_FOR_EACH_KNOWN_ASPECT(ASPECT_SET_IMPL_MAP_NAME)
     default:
       throw std::logic_error("Failed to map_name");
   }
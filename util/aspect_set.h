@@ -11,32 +11,232 @@
 
 #include "../tests/common/common.h"
 
-#include <set>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
 #include <string>
 
 namespace sycl_cts::util::aspect {
 
+/** @brief Applies the macro given to the name of each aspect that can be
+ *         stored within aspect_set
+ *  @details Single source for both known_aspects and the aspect names
+ */
+#define SYCL_CTS_FOR_EACH_KNOWN_ASPECT(MACRO) \
+  MACRO(cpu)                                  \
+  MACRO(gpu)                                  \
+  MACRO(accelerator)                          \
+  MACRO(custom)                               \
+  /* MACRO(emulated) */                       \
+  /* MACRO(host_debuggable) */                \
+  MACRO(fp16)                                 \
+  MACRO(fp64)                                 \
+  MACRO(atomic64)                             \
+  MACRO(image)                                \
+  MACRO(online_compiler)                      \
+  MACRO(online_linker)                        \
+  MACRO(queue_profiling)                      \
+  MACRO(usm_device_allocations)               \
+  MACRO(usm_host_allocations)                 \
+  MACRO(usm_atomic_host_allocations)          \
+  MACRO(usm_shared_allocations)               \
+  MACRO(usm_atomic_shared_allocations)        \
+  MACRO(usm_system_allocations)
+
+#define ASPECT_SET_IMPL_ENUMERATOR(aspectName) sycl::aspect::aspectName,
+
+/** @brief Aspects that can be stored within aspect_set
+ *  @details Position within this list defines the bit used for the aspect
+ */
+inline constexpr sycl::aspect known_aspects[] = {
+    SYCL_CTS_FOR_EACH_KNOWN_ASPECT(ASPECT_SET_IMPL_ENUMERATOR)};
+
+#undef ASPECT_SET_IMPL_ENUMERATOR
+
+inline constexpr std::size_t known_aspects_count =
+    sizeof(known_aspects) / sizeof(known_aspects[0]);
+
+/** @brief Check if aspect given can be stored within aspect_set
+ */
+constexpr bool is_known(sycl::aspect asp) {
+  for (std::size_t i = 0; i < known_aspects_count; ++i) {
+    if (known_aspects[i] == asp) return true;
+  }
+  return false;
+}
+
 /** @brief Provides set of aspects to work with
- *  @details Example of usage:
- *             util::aspect::aspect_set set1{
+ *  @details Stored as a bitset, so union, intersection and subset checks are
+ *           single bitwise operations. All operations are constexpr, and the
+ *           set can be passed as a template parameter via its mask:
+ *             template <util::aspect::aspect_set::mask_type Mask>
+ *             void run() {
+ *               constexpr auto aspects = util::aspect::aspect_set(Mask);
+ *               ...
+ *             }
+ *
+ *           Example of usage:
+ *             constexpr util::aspect::aspect_set set1{
  *               sycl::aspect::cpu,
  *               sycl::aspect::gpu,
  *               sycl::aspect::fp16,
  *               sycl::aspect::fp64
  *             };
- *             util::aspect::aspect_set set2{
+ *             constexpr util::aspect::aspect_set set2{
  *               sycl::aspect::custom,
  *               sycl::aspect::queue_profiling,
  *               sycl::aspect::fp16,
  *               sycl::aspect::fp64
- *             } ;
- *             util::aspect::aspect_set intersection;
- *             std::set_intersection(set1.begin(), set1.end(),
- *                                   set2.begin(), set2.end(),
- *                                   std::back_inserter(intersection));
- *             log.note(util::aspect::to_string(intersections));
+ *             };
+ *             constexpr auto intersection = set1 & set2;
+ *             static_assert(intersection.is_subset_of(set1));
+ *             log.note(util::aspect::to_string(intersection));
  */
-using aspect_set = std::set<sycl::aspect>;
+class aspect_set {
+ public:
+  using mask_type = std::uint64_t;
+  using value_type = sycl::aspect;
+  using size_type = std::size_t;
+
+  static_assert(known_aspects_count <= sizeof(mask_type) * 8,
+                "Too many aspects for aspect_set mask");
+
+  /** @brief Iterates over the aspects of the set in known_aspects order
+   */
+  class const_iterator {
+    mask_type m_mask;
+    size_type m_index;
+
+    constexpr void skip_unset() {
+      while (m_index < known_aspects_count && !((m_mask >> m_index) & 1u)) {
+        ++m_index;
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = sycl::aspect;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const sycl::aspect*;
+    using reference = const sycl::aspect&;
+
+    constexpr const_iterator(mask_type mask, size_type index)
+        : m_mask(mask), m_index(index) {
+      skip_unset();
+    }
+
+    constexpr reference operator*() const { return known_aspects[m_index]; }
+    constexpr pointer operator->() const { return &known_aspects[m_index]; }
+
+    constexpr const_iterator& operator++() {
+      ++m_index;
+      skip_unset();
+      return *this;
+    }
+    constexpr const_iterator operator++(int) {
+      auto result = *this;
+      ++(*this);
+      return result;
+    }
+
+    constexpr bool operator==(const const_iterator& other) const {
+      return m_index == other.m_index;
+    }
+    constexpr bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+  };
+  using iterator = const_iterator;
+
+  constexpr aspect_set() : m_mask(0) {}
+  constexpr explicit aspect_set(mask_type mask) : m_mask(mask & all_mask()) {}
+  constexpr aspect_set(std::initializer_list<sycl::aspect> aspects)
+      : m_mask(0) {
+    for (const auto asp : aspects) insert(asp);
+  }
+
+  /** @brief Provides the underlying mask, usable as a template parameter
+   */
+  constexpr mask_type to_mask() const { return m_mask; }
+
+  constexpr bool empty() const { return m_mask == 0; }
+  constexpr size_type size() const {
+    size_type result = 0;
+    for (mask_type mask = m_mask; mask != 0; mask &= mask - 1) ++result;
+    return result;
+  }
+
+  constexpr bool contains(sycl::aspect asp) const {
+    return is_known(asp) && (m_mask & bit(asp)) != 0;
+  }
+  constexpr size_type count(sycl::aspect asp) const {
+    return contains(asp) ? 1 : 0;
+  }
+
+  constexpr void insert(sycl::aspect asp) { m_mask |= bit(asp); }
+  template <typename InputIt>
+  constexpr void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }
+  constexpr void erase(sycl::aspect asp) { m_mask &= ~bit(asp); }
+  constexpr void clear() { m_mask = 0; }
+
+  constexpr bool is_subset_of(const aspect_set& other) const {
+    return (m_mask & ~other.m_mask) == 0;
+  }
+
+  constexpr aspect_set& operator|=(const aspect_set& other) {
+    m_mask |= other.m_mask;
+    return *this;
+  }
+  constexpr aspect_set& operator&=(const aspect_set& other) {
+    m_mask &= other.m_mask;
+    return *this;
+  }
+  constexpr aspect_set& operator-=(const aspect_set& other) {
+    m_mask &= ~other.m_mask;
+    return *this;
+  }
+
+  friend constexpr aspect_set operator|(aspect_set lhs, const aspect_set& rhs) {
+    return lhs |= rhs;
+  }
+  friend constexpr aspect_set operator&(aspect_set lhs, const aspect_set& rhs) {
+    return lhs &= rhs;
+  }
+  friend constexpr aspect_set operator-(aspect_set lhs, const aspect_set& rhs) {
+    return lhs -= rhs;
+  }
+  friend constexpr bool operator==(const aspect_set& lhs,
+                                   const aspect_set& rhs) {
+    return lhs.m_mask == rhs.m_mask;
+  }
+  friend constexpr bool operator!=(const aspect_set& lhs,
+                                   const aspect_set& rhs) {
+    return !(lhs == rhs);
+  }
+
+  constexpr const_iterator begin() const { return {m_mask, 0}; }
+  constexpr const_iterator end() const { return {m_mask, known_aspects_count}; }
+
+ private:
+  mask_type m_mask;
+
+  static constexpr mask_type all_mask() {
+    return known_aspects_count == sizeof(mask_type) * 8
+               ? ~mask_type{0}
+               : (mask_type{1} << known_aspects_count) - 1;
+  }
+
+  static constexpr mask_type bit(sycl::aspect asp) {
+    for (size_type i = 0; i < known_aspects_count; ++i) {
+      if (known_aspects[i] == asp) return mask_type{1} << i;
+    }
+    throw std::logic_error("Aspect is not supported by aspect_set");
+  }
+};
 
 /** @brief Provides string representation of sycl::aspect
  */
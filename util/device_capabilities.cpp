@@ -0,0 +1,55 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides cached snapshots of device capabilities
+//
+*******************************************************************************/
+
+#include "device_capabilities.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace sycl_cts::util {
+
+device_capabilities::device_capabilities(const sycl::device& device)
+    : sub_group_sizes(device.get_info<sycl::info::device::sub_group_sizes>()),
+      max_work_group_size(
+          device.get_info<sycl::info::device::max_work_group_size>()) {
+  for (const auto asp : device.get_info<sycl::info::device::aspects>()) {
+    if (aspect::is_known(asp)) {
+      aspects.insert(asp);
+    } else {
+      other_aspects.push_back(asp);
+    }
+  }
+  std::sort(sub_group_sizes.begin(), sub_group_sizes.end());
+}
+
+bool device_capabilities::has(sycl::aspect asp) const {
+  if (aspect::is_known(asp)) return aspects.contains(asp);
+  return std::find(other_aspects.begin(), other_aspects.end(), asp) !=
+         other_aspects.end();
+}
+
+bool device_capabilities::has_sub_group_size(size_t value) const {
+  return std::binary_search(sub_group_sizes.begin(), sub_group_sizes.end(),
+                            value);
+}
+
+const device_capabilities& get_capabilities(const sycl::device& device) {
+  static std::mutex mutex;
+  // References to elements stay valid on rehashing
+  static std::unordered_map<sycl::device, device_capabilities> cache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = cache.find(device);
+  if (it == cache.end()) {
+    it = cache.emplace(device, device_capabilities(device)).first;
+  }
+  return it->second;
+}
+
+}  // namespace sycl_cts::util
@@ -0,0 +1,49 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides cached snapshots of device capabilities
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_DEVICE_CAPABILITIES_H
+#define __SYCLCTS_UTIL_DEVICE_CAPABILITIES_H
+
+#include "../tests/common/common.h"
+
+#include "aspect_set.h"
+#include <vector>
+
+namespace sycl_cts::util {
+
+/** @brief Immutable snapshot of the device capabilities used to check kernel
+ *         restrictions
+ *  @details Captured once per device, so that filtering devices does not
+ *           require any further runtime queries
+ */
+struct device_capabilities {
+  aspect::aspect_set aspects;
+  /** @brief Supported aspects that aspect_set cannot store, such as
+   *         implementation-specific ones
+   */
+  std::vector<sycl::aspect> other_aspects;
+  /** @brief Supported sub-group sizes, sorted in ascending order
+   */
+  std::vector<size_t> sub_group_sizes;
+  size_t max_work_group_size;
+
+  explicit device_capabilities(const sycl::device& device);
+
+  bool has(sycl::aspect asp) const;
+  bool has_sub_group_size(size_t value) const;
+};
+
+/** @brief Provides the capabilities snapshot for the device given
+ *  @details The snapshot is captured on first request for each device and
+ *           cached for the lifetime of the process
+ */
+const device_capabilities& get_capabilities(const sycl::device& device);
+
+}  // namespace sycl_cts::util
+
+#endif  // __SYCLCTS_UTIL_DEVICE_CAPABILITIES_H
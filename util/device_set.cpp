@@ -9,6 +9,7 @@
 
 #include "device_set.h"
 #include "cpp_compat.h"
+#include "device_capabilities.h"
 
 #include <algorithm>
 #include <stdexcept>
@@ -56,7 +57,7 @@ void device_set::intersect(const device_set& other) {
 void device_set::removeDevsWith(sycl::aspect aspect) {
   auto condition = [&](const StorageType::iterator& it) {
     const auto& device = *it;
-    return device.has(aspect);
+    return get_capabilities(device).has(aspect);
   };
   util::erase_if(m_devices, condition);
 }
@@ -70,7 +71,7 @@ void device_set::removeDevsWith(std::initializer_list<sycl::aspect> aspects) {
 void device_set::removeDevsWithout(sycl::aspect aspect) {
   auto condition = [&](const StorageType::iterator& it) {
     const auto& device = *it;
-    return !device.has(aspect);
+    return !get_capabilities(device).has(aspect);
   };
   util::erase_if(m_devices, condition);
 }
@@ -0,0 +1,101 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides tracking of host and device memory usage
+//
+*******************************************************************************/
+
+#include "memory_tracker.h"
+
+#if defined(__linux__)
+#include <unistd.h>
+
+#include <fstream>
+#include <limits>
+#include <string>
+#endif
+
+namespace sycl_cts::util {
+
+const char* to_string(tracked_memory kind) {
+  switch (kind) {
+    case tracked_memory::usm_device:
+      return "usm_device";
+    case tracked_memory::usm_host:
+      return "usm_host";
+    case tracked_memory::usm_shared:
+      return "usm_shared";
+    case tracked_memory::buffer:
+      return "buffer";
+    default:
+      return "unknown";
+  }
+}
+
+void memory_tracker::allocated(tracked_memory kind, size_t bytes) {
+  const auto index = static_cast<size_t>(kind);
+  const size_t live = m_live[index].fetch_add(bytes) + bytes;
+  size_t peak = m_peak[index].load();
+  while (peak < live && !m_peak[index].compare_exchange_weak(peak, live)) {
+  }
+}
+
+void memory_tracker::released(tracked_memory kind, size_t bytes) {
+  m_live[static_cast<size_t>(kind)].fetch_sub(bytes);
+}
+
+size_t memory_tracker::live(tracked_memory kind) const {
+  return m_live[static_cast<size_t>(kind)].load();
+}
+
+size_t memory_tracker::peak(tracked_memory kind) const {
+  return m_peak[static_cast<size_t>(kind)].load();
+}
+
+void memory_tracker::reset_peaks() {
+  for (size_t i = 0; i < kinds_count; ++i) {
+    m_peak[i].store(m_live[i].load());
+  }
+}
+
+host_memory_usage get_host_memory_usage() {
+  host_memory_usage result{0, 0};
+#if defined(__linux__)
+  // Second field of statm is the resident set size in pages
+  std::ifstream statm("/proc/self/statm");
+  size_t total_pages = 0;
+  size_t resident_pages = 0;
+  if (statm >> total_pages >> resident_pages) {
+    result.current_rss =
+        resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  }
+
+  // Unlike getrusage, VmHWM can be reset through reset_host_peak_rss
+  std::ifstream status("/proc/self/status");
+  std::string key;
+  while (status >> key) {
+    if (key == "VmHWM:") {
+      size_t kilobytes = 0;
+      if (status >> kilobytes) result.peak_rss = kilobytes * 1024;
+      break;
+    }
+    status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+#endif
+  return result;
+}
+
+bool reset_host_peak_rss() {
+#if defined(__linux__)
+  // Writing 5 resets the peak resident set size, see proc(5)
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return static_cast<bool>(clear_refs);
+#else
+  return false;
+#endif
+}
+
+}  // namespace sycl_cts::util
@@ -0,0 +1,77 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides tracking of host and device memory usage
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_MEMORY_TRACKER_H
+#define __SYCLCTS_UTIL_MEMORY_TRACKER_H
+
+#include "singleton.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace sycl_cts::util {
+
+/** @brief Kinds of memory tracked by memory_tracker
+ */
+enum class tracked_memory { usm_device, usm_host, usm_shared, buffer, count };
+
+/** @brief Provides string representation of tracked_memory
+ */
+const char* to_string(tracked_memory kind);
+
+/** @brief Keeps live and peak byte counts of the memory allocated through the
+ *         CTS helpers
+ *  @details Allocations are registered by usm_helper::allocate_usm_memory and
+ *           memory_tracking::make_buffer. Peaks can be reset, so that the
+ *           memory report listener can provide them per test case.
+ */
+class memory_tracker : public singleton<memory_tracker> {
+ public:
+  void allocated(tracked_memory kind, size_t bytes);
+  void released(tracked_memory kind, size_t bytes);
+
+  size_t live(tracked_memory kind) const;
+  size_t peak(tracked_memory kind) const;
+
+  /** @brief Set peak values to the currently live byte counts
+   */
+  void reset_peaks();
+
+ private:
+  static constexpr size_t kinds_count =
+      static_cast<size_t>(tracked_memory::count);
+
+  std::array<std::atomic<size_t>, kinds_count> m_live{};
+  std::array<std::atomic<size_t>, kinds_count> m_peak{};
+};
+
+/** @brief Host process memory usage
+ *  @details Values are zero on platforms where they cannot be queried
+ */
+struct host_memory_usage {
+  /** @brief Resident set size at the moment of query
+   */
+  size_t current_rss;
+  /** @brief Highest resident set size of the process since start, or since
+   *         the last successful reset_host_peak_rss
+   */
+  size_t peak_rss;
+};
+
+host_memory_usage get_host_memory_usage();
+
+/** @brief Reset the peak resident set size to the current one
+ *  @retval Whether the peak was reset; it cannot be on platforms other than
+ *          Linux or if /proc/self/clear_refs is not writable
+ */
+bool reset_host_peak_rss();
+
+}  // namespace sycl_cts::util
+
+#endif  // __SYCLCTS_UTIL_MEMORY_TRACKER_H
@@ -39,17 +39,33 @@ namespace util {
 template <typename T>
 class test_proxy {
  public:
+  /**
+   * Registers the test case by name only. The test object is constructed on
+   * demand by Catch2 once the test case is selected to run, so neither
+   * listing nor filtered runs pay for constructing the test objects of all
+   * test cases within the binary.
+   * @param name Test case name, the same as provided by T::get_info
+   */
+  explicit test_proxy(const char* name) { register_test(name); }
+
+  /**
+   * Registers the test case with the name provided by T::get_info, which
+   * requires constructing the test object during static initialization.
+   */
   test_proxy() {
     test_base::info info;
     T{}.get_info_legacy(info);
+    register_test(info.m_name);
+  }
 
+ private:
+  static void register_test(const std::string& name) {
     Catch::AutoReg(
         Catch::makeTestInvoker<T>(&T::run_legacy), {__FILE__, __LINE__},
         "__SYCL_CTS_LEGACY_TEST__" + std::to_string(next_legacy_test_id++),
-        {info.m_name, "[legacy]"});
+        {name, "[legacy]"});
   }
 
- private:
   inline static size_t next_legacy_test_id = 0;
 };
 
@@ -13,9 +13,29 @@
 #include <string_view>
 #include <sycl/sycl.hpp>
 
+#include "memory_tracker.h"
+
 namespace usm_helper {
 
+/** @brief Returns the memory_tracker kind for the USM allocation type
+ *  @tparam alloc USM allocation type
+ */
+template <sycl::usm::alloc alloc>
+constexpr sycl_cts::util::tracked_memory get_tracked_memory() {
+  if constexpr (alloc == sycl::usm::alloc::shared) {
+    return sycl_cts::util::tracked_memory::usm_shared;
+  } else if constexpr (alloc == sycl::usm::alloc::device) {
+    return sycl_cts::util::tracked_memory::usm_device;
+  } else if constexpr (alloc == sycl::usm::alloc::host) {
+    return sycl_cts::util::tracked_memory::usm_host;
+  } else {
+    static_assert(alloc != alloc, "Unknown USM allocation type");
+  }
+}
+
 /** @brief Return std::unique_ptr with allocated USM object
+ *  @details Allocation is registered within sycl_cts::util::memory_tracker
+ *           for the lifetime of the returned object
  *  @tparam USM allocation type
  *  @param queue sycl::queue class object
  */
@@ -29,24 +49,30 @@ auto allocate_usm_memory(const sycl::queue &queue, size_t num_elements = 1) {
                          ? queue.get_context().get_devices()[0]
                          : queue.get_device()};
 
-  auto deleter = [=](elems_typeT *ptr) { sycl::free(ptr, context); };
+  constexpr auto tracked_kind = get_tracked_memory<alloc>();
+  const size_t bytes = num_elements * sizeof(elems_typeT);
+  auto deleter = [=](elems_typeT *ptr) {
+    sycl::free(ptr, context);
+    sycl_cts::util::get<sycl_cts::util::memory_tracker>().released(
+        tracked_kind, bytes);
+  };
 
+  elems_typeT *ptr = nullptr;
   if constexpr (alloc == sycl::usm::alloc::shared) {
-    std::unique_ptr<elems_typeT, decltype(deleter)> usm_memory(
-        sycl::malloc_shared<elems_typeT>(num_elements, device, context),
-        deleter);
-    return usm_memory;
+    ptr = sycl::malloc_shared<elems_typeT>(num_elements, device, context);
   } else if constexpr (alloc == sycl::usm::alloc::device) {
-    std::unique_ptr<elems_typeT, decltype(deleter)> usm_memory(
-        sycl::malloc_device<elems_typeT>(num_elements, queue), deleter);
-    return usm_memory;
+    ptr = sycl::malloc_device<elems_typeT>(num_elements, queue);
   } else if constexpr (alloc == sycl::usm::alloc::host) {
-    std::unique_ptr<elems_typeT, decltype(deleter)> usm_memory(
-        sycl::malloc_host<elems_typeT>(num_elements, context), deleter);
-    return usm_memory;
+    ptr = sycl::malloc_host<elems_typeT>(num_elements, context);
   } else {
     static_assert(alloc != alloc, "Unknown USM allocation type");
   }
+  std::unique_ptr<elems_typeT, decltype(deleter)> usm_memory(ptr, deleter);
+  if (usm_memory) {
+    sycl_cts::util::get<sycl_cts::util::memory_tracker>().allocated(
+        tracked_kind, bytes);
+  }
+  return usm_memory;
 };
 
 /** @brief Returns an aspect depending on the type of allocated memory